@@ -35,7 +35,13 @@
 
 #include <queue>
 #include <set>
+#include <map>
+#include <deque>
+#include <limits>
+#include <memory_resource>
+#include <algorithm>
 #include <vector>
+#include <cstdint>
 #include <fplus/fplus.hpp>
 #include <range/v3/all.hpp>
 #include <concepts>
@@ -73,6 +79,278 @@ requires (T t)
   { t } -> std::signed_integral;
 };
 
+// Numbering of the cells of a bounded grid into [0,size()), such as Bounds
+// or the tiled layouts of celaeno::math::tiled
+template<typename G>
+concept Grid =
+requires(G const g, std::pair<int64_t,int64_t> p, int64_t i)
+{
+  { g.size()      } -> std::convertible_to<size_t>;
+  { g.contains(p) } -> std::convertible_to<bool>;
+  { g.index(p)    } -> std::convertible_to<int64_t>;
+  { g.cell(i)     } -> std::convertible_to<std::pair<int64_t,int64_t>>;
+};
+
+//
+// Grid
+//
+
+// Inclusive rectangle of cells, cells are numbered in row-major order with
+// first as the row and second as the column
+struct Bounds
+{
+  std::pair<int64_t,int64_t> min;
+  std::pair<int64_t,int64_t> max;
+
+  int64_t rows() const noexcept { return max.first - min.first + 1; }
+  int64_t cols() const noexcept { return max.second - min.second + 1; }
+  size_t size() const noexcept { return static_cast<size_t>(rows() * cols()); }
+
+  template<typename P>
+  bool contains(P const& p) const noexcept
+  {
+    return p.first >= min.first && p.first <= max.first
+      && p.second >= min.second && p.second <= max.second;
+  }
+
+  template<typename P>
+  int64_t index(P const& p) const noexcept
+  {
+    return (p.first - min.first) * cols() + (p.second - min.second);
+  }
+
+  std::pair<int64_t,int64_t> cell(int64_t i) const noexcept
+  {
+    return {min.first + i / cols(), min.second + i % cols()};
+  }
+}; // struct: Bounds
+
+// Binary min-heap over cell indices with decrease-key, the position of each
+// cell in the heap is kept in a flat array (-1 when not queued)
+template<typename Key = float64_t>
+class Heap
+{
+  public:
+    explicit Heap(size_t cells = 0) : m_position(cells, -1) {}
+
+    bool empty() const noexcept { return m_heap.empty(); }
+    size_t size() const noexcept { return m_heap.size(); }
+
+    // Lowest key in the heap
+    Key top() const noexcept { return m_heap.front().first; }
+
+    bool contains(int64_t i) const noexcept { return m_position[static_cast<size_t>(i)] >= 0; }
+
+    // Drop the queued cells, O(queued)
+    void clear()
+    {
+      for (auto const& [key,i] : m_heap) { m_position[static_cast<size_t>(i)] = -1; }
+      m_heap.clear();
+    }
+
+    // Grow the position array to hold cells
+    void reserve(size_t cells)
+    {
+      if( m_position.size() < cells ) { m_position.resize(cells, -1); }
+    }
+
+    // Insert cell i or lower its key
+    void push(int64_t i, Key key)
+    {
+      auto& pos {m_position[static_cast<size_t>(i)]};
+      if( pos < 0 )
+      {
+        pos = static_cast<int64_t>(m_heap.size());
+        m_heap.emplace_back(key, i);
+      }
+      else if( key < m_heap[static_cast<size_t>(pos)].first )
+      {
+        m_heap[static_cast<size_t>(pos)].first = key;
+      }
+      else
+      {
+        return;
+      } // if
+      up(static_cast<size_t>(pos));
+    }
+
+    // Insert cell i or set its key, higher or lower
+    void update(int64_t i, Key key)
+    {
+      if( ! contains(i) ) { push(i, key); return; }
+      auto pos {static_cast<size_t>(m_position[static_cast<size_t>(i)])};
+      m_heap[pos].first = key;
+      up(pos);
+      down(static_cast<size_t>(m_position[static_cast<size_t>(i)]));
+    }
+
+    // Remove cell i if queued
+    void erase(int64_t i)
+    {
+      if( ! contains(i) ) { return; }
+      auto pos {static_cast<size_t>(m_position[static_cast<size_t>(i)])};
+      swap(pos, m_heap.size()-1);
+      m_heap.pop_back();
+      m_position[static_cast<size_t>(i)] = -1;
+      if( pos < m_heap.size() )
+      {
+        auto moved {m_heap[pos].second};
+        up(pos);
+        down(static_cast<size_t>(m_position[static_cast<size_t>(moved)]));
+      } // if
+    }
+
+    // Remove and return the cell with the lowest key
+    int64_t pop()
+    {
+      auto i {m_heap.front().second};
+      swap(0, m_heap.size()-1);
+      m_heap.pop_back();
+      m_position[static_cast<size_t>(i)] = -1;
+      if( ! m_heap.empty() ) { down(0); }
+      return i;
+    }
+
+  private:
+    void swap(size_t a, size_t b)
+    {
+      std::swap(m_heap[a], m_heap[b]);
+      m_position[static_cast<size_t>(m_heap[a].second)] = static_cast<int64_t>(a);
+      m_position[static_cast<size_t>(m_heap[b].second)] = static_cast<int64_t>(b);
+    }
+
+    void up(size_t k)
+    {
+      while( k > 0 && m_heap[k].first < m_heap[(k-1)/2].first )
+      {
+        swap(k, (k-1)/2);
+        k = (k-1)/2;
+      } // while
+    }
+
+    void down(size_t k)
+    {
+      while( true )
+      {
+        auto [l,r] {std::make_pair(2*k+1, 2*k+2)};
+        auto m {k};
+        if( l < m_heap.size() && m_heap[l].first < m_heap[m].first ) { m = l; }
+        if( r < m_heap.size() && m_heap[r].first < m_heap[m].first ) { m = r; }
+        if( m == k ) { return; }
+        swap(k, m);
+        k = m;
+      } // while
+    }
+
+    std::vector<std::pair<Key,int64_t>> m_heap{};
+    std::vector<int64_t> m_position{};
+}; // class: Heap
+
+//
+// Search context
+//
+
+// Containers of a search, kept between calls so that routing many nets
+// does not reallocate them. The tree containers of the unbounded search
+// draw their nodes from a pool owned by the context, so clearing them
+// returns the nodes to the pool instead of the heap. The arrays of the
+// bounded search are stamped with a generation: a cell whose stamp is not
+// the current generation is unvisited, so a reset only bumps the
+// generation and drops the cells left in the heap.
+template<typename Base = std::pair<int64_t,int64_t>>
+class SearchContext
+{
+  public:
+    SearchContext()
+      : m_pool{}
+      , m_open{&m_pool}
+      , m_closed{&m_pool}
+      , m_g_score{&m_pool}
+      , m_mem{&m_pool}
+    {}
+
+    SearchContext(SearchContext const&) = delete;
+    SearchContext& operator=(SearchContext const&) = delete;
+
+    // Prepare the containers of the unbounded search
+    void reset()
+    {
+      m_open.clear();
+      m_closed.clear();
+      m_g_score.clear();
+      m_mem.clear();
+    }
+
+    // Prepare the arrays of the bounded search for bounds
+    template<Grid G>
+    void reset(G const& bounds)
+    {
+      m_heap.clear();
+      if( m_stamp.size() < bounds.size() )
+      {
+        m_stamp.resize(bounds.size(), 0);
+        m_g_score_grid.resize(bounds.size());
+        m_parent.resize(bounds.size());
+        m_heap.reserve(bounds.size());
+      } // if
+      // Restart the stamps when the generation wraps around
+      if( (m_generation += 2) < 2 )
+      {
+        std::ranges::fill(m_stamp, 0);
+        m_generation = 2;
+      } // if
+    }
+
+    // Score and parent of cell i, unvisited cells have an infinite score
+    float64_t g_score(int64_t i) const noexcept
+    {
+      return visited(i)? m_g_score_grid[static_cast<size_t>(i)]
+        : std::numeric_limits<float64_t>::infinity();
+    }
+    int64_t parent(int64_t i) const noexcept
+    {
+      return visited(i)? m_parent[static_cast<size_t>(i)] : -1;
+    }
+
+    // Closed cells carry the generation plus one
+    bool closed(int64_t i) const noexcept { return m_stamp[static_cast<size_t>(i)] == m_generation+1; }
+    void close(int64_t i) noexcept { m_stamp[static_cast<size_t>(i)] = m_generation+1; }
+
+    void relax(int64_t i, float64_t g, int64_t p) noexcept
+    {
+      m_stamp[static_cast<size_t>(i)] = m_generation;
+      m_g_score_grid[static_cast<size_t>(i)] = g;
+      m_parent[static_cast<size_t>(i)] = p;
+    }
+
+    // Open set of the bounded search
+    Heap<>& open() noexcept { return m_heap; }
+
+  private:
+    bool visited(int64_t i) const noexcept
+    {
+      auto stamp {m_stamp[static_cast<size_t>(i)]};
+      return stamp == m_generation || stamp == m_generation+1;
+    }
+
+    template<BaseType T, typename F1, typename F2, typename F3, typename B>
+    friend std::deque<B> a_star(T&&, T&&, F1&&, F2&&, F3&&, SearchContext<B>&);
+
+    // Unbounded search
+    std::pmr::unsynchronized_pool_resource m_pool;
+    std::pmr::multimap<float64_t,Base> m_open;
+    std::pmr::set<Base> m_closed;
+    std::pmr::map<Base,float64_t> m_g_score;
+    std::pmr::map<Base,Base> m_mem;
+
+    // Bounded search
+    uint32_t m_generation{0};
+    std::vector<uint32_t> m_stamp{};
+    std::vector<float64_t> m_g_score_grid{};
+    std::vector<int64_t> m_parent{};
+    Heap<> m_heap{};
+}; // class: SearchContext
+
 //
 // Helpers
 //
@@ -100,7 +378,10 @@ auto rebuild_path(Map& m, T curr)
     std::is_integral_v<T>, int64_t, std::pair<int64_t,int64_t>
   >;
 
-  m = fp::swap_keys_and_values(m);
+  // Swap keys and values, keeping the allocator of the memory
+  Map swapped(m.get_allocator());
+  for (auto const& [k,v] : m) { swapped.emplace(v,k); }
+  m = std::move(swapped);
 
   std::deque<Base> final_path;
 
@@ -115,25 +396,11 @@ auto rebuild_path(Map& m, T curr)
   return final_path;
 }
 
-template<BaseType T, typename F1, typename F2, typename F3>
-decltype(auto) a_star(T&& start, T&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic)
+template<typename Base, typename T1, typename T2, typename F1, typename F2, typename F3,
+  typename Open, typename Closed, typename GScore, typename Mem>
+std::deque<Base> search(T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic,
+  Open& open, Closed& closed, GScore& g_score, Mem& mem)
 {
-  using Base = std::conditional_t<std::is_integral_v<T>,
-    int64_t, std::pair<int64_t,int64_t>
-  >;
-
-  // Open set in ascending order
-  std::multimap<float64_t,Base> open;
-
-  // Closed set
-  std::set<Base> closed;
-
-  // G-Score
-  std::map<Base,float64_t> g_score;
-
-  // Paths memory
-  std::map<Base,Base> mem;
-
   // Insert initial vertex
   open.emplace(f_heuristic(start), start);
   g_score.emplace(start, 0.);
@@ -186,4 +453,201 @@ decltype(auto) a_star(T&& start, T&& end, F1&& f_neighbors, F2&& f_distance, F3&
   return std::deque<Base>{};
 }
 
+template<BaseType T, typename F1, typename F2, typename F3>
+decltype(auto) a_star(T&& start, T&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic)
+{
+  using Base = std::conditional_t<std::is_integral_v<T>,
+    int64_t, std::pair<int64_t,int64_t>
+  >;
+
+  // Open set in ascending order
+  std::multimap<float64_t,Base> open;
+
+  // Closed set
+  std::set<Base> closed;
+
+  // G-Score
+  std::map<Base,float64_t> g_score;
+
+  // Paths memory
+  std::map<Base,Base> mem;
+
+  return search<Base>(start, end, f_neighbors, f_distance, f_heuristic, open, closed, g_score, mem);
+}
+
+// Same search with the containers owned by ctx, reused across calls
+template<BaseType T, typename F1, typename F2, typename F3, typename Base>
+std::deque<Base> a_star(T&& start, T&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic,
+  SearchContext<Base>& ctx)
+{
+  ctx.reset();
+  return search<Base>(start, end, f_neighbors, f_distance, f_heuristic,
+    ctx.m_open, ctx.m_closed, ctx.m_g_score, ctx.m_mem);
+}
+
+// A* restricted to the cells inside bounds. G-scores, parents and the closed
+// flags live in the flat arrays of ctx, indexed by the numbering of the grid
+// (row-major for Bounds, tiled for math::tiled::Layout), and the open set is
+// an indexed binary heap with decrease-key. Neighbors outside the bounds are
+// skipped. Returns the cells from start to end, empty if end is not
+// reachable.
+template<Grid G, BaseType T1, BaseType T2, typename F1, typename F2, typename F3, typename B>
+std::deque<std::pair<int64_t,int64_t>>
+  a_star(G const& bounds, T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic,
+    SearchContext<B>& ctx)
+{
+  using Base = std::pair<int64_t,int64_t>;
+
+  if( ! bounds.contains(start) || ! bounds.contains(end) ) return {};
+
+  ctx.reset(bounds);
+  auto& open {ctx.open()};
+
+  auto s {bounds.index(start)};
+  auto e {bounds.index(end)};
+  ctx.relax(s, 0., -1);
+  open.push(s, f_heuristic(Base{start.first,start.second}));
+
+  while( ! open.empty() )
+  {
+    auto i {open.pop()};
+
+    // Rebuild the path through the parents
+    if( i == e )
+    {
+      std::deque<Base> path;
+      for (auto c{i}; c != -1; c = ctx.parent(c)) { path.emplace_front(bounds.cell(c)); }
+      return path;
+    } // if
+
+    ctx.close(i);
+    auto g {ctx.g_score(i)};
+
+    for (auto&& n : f_neighbors(bounds.cell(i)))
+    {
+      if( ! bounds.contains(n) ) continue;
+
+      auto j {bounds.index(n)};
+      if( ctx.closed(j) ) continue;
+
+      auto ng {g+f_distance(n)};
+      if( ng < ctx.g_score(j) )
+      {
+        ctx.relax(j, ng, i);
+        open.push(j, ng+f_heuristic(n));
+      } // if
+    } // for: n
+  } // while ! open.empty()
+
+  return {};
+}
+
+template<Grid G, BaseType T1, BaseType T2, typename F1, typename F2, typename F3>
+std::deque<std::pair<int64_t,int64_t>>
+  a_star(G const& bounds, T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic)
+{
+  SearchContext<> ctx;
+  return a_star(bounds, std::forward<T1>(start), std::forward<T2>(end),
+    f_neighbors, f_distance, f_heuristic, ctx);
+}
+
+// Bidirectional A* restricted to the cells inside bounds, growing one
+// frontier from start over f_neighbors and one from end over the same
+// neighbors walked backwards, so the neighbor relation must be symmetric.
+// f_distance(n) is the cost of entering n and f_heuristic(a,b) estimates the
+// cost between two cells; it must be consistent. Both frontiers use the
+// average potential (h(v,end) - h(start,v))/2, which keeps the reduced costs
+// of both directions non-negative, and the search stops once the lowest keys
+// of the two frontiers add up to the best meeting cost found. Returns the
+// cells from start to end, empty if end is not reachable.
+template<Grid G, BaseType T1, BaseType T2, typename F1, typename F2, typename F3, typename B>
+std::deque<std::pair<int64_t,int64_t>>
+  bidirectional(G const& bounds, T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic,
+    SearchContext<B>& forward, SearchContext<B>& backward)
+{
+  using Base = std::pair<int64_t,int64_t>;
+
+  if( ! bounds.contains(start) || ! bounds.contains(end) ) return {};
+
+  Base const s_cell{start.first,start.second};
+  Base const e_cell{end.first,end.second};
+  auto potential = [&](Base const& v) -> float64_t
+  {
+    return (f_heuristic(v, e_cell) - f_heuristic(s_cell, v)) / 2.;
+  };
+
+  forward.reset(bounds);
+  backward.reset(bounds);
+
+  auto s {bounds.index(start)};
+  auto e {bounds.index(end)};
+  forward.relax(s, 0., -1);
+  forward.open().push(s, potential(s_cell));
+  backward.relax(e, 0., -1);
+  backward.open().push(e, -potential(e_cell));
+
+  // Best path found so far and the cell where its halves meet
+  auto best {std::numeric_limits<float64_t>::infinity()};
+  int64_t meet{-1};
+  if( s == e ) { best = 0.; meet = s; }
+
+  while( ! forward.open().empty() && ! backward.open().empty() )
+  {
+    if( forward.open().top() + backward.open().top() >= best ) break;
+
+    // Expand the smaller frontier
+    bool const is_forward {forward.open().size() <= backward.open().size()};
+    auto& ctx {is_forward? forward : backward};
+    auto& other {is_forward? backward : forward};
+
+    auto i {ctx.open().pop()};
+    ctx.close(i);
+    auto g {ctx.g_score(i)};
+    auto cell {bounds.cell(i)};
+
+    // Walking backwards, moving from i to n enters i
+    auto back_cost {is_forward? 0. : static_cast<float64_t>(f_distance(cell))};
+
+    for (auto&& n : f_neighbors(cell))
+    {
+      if( ! bounds.contains(n) ) continue;
+
+      auto j {bounds.index(n)};
+      if( ctx.closed(j) ) continue;
+
+      auto ng {g + (is_forward? static_cast<float64_t>(f_distance(n)) : back_cost)};
+      if( ng < ctx.g_score(j) )
+      {
+        ctx.relax(j, ng, i);
+        auto p {potential(Base{n.first,n.second})};
+        ctx.open().push(j, ng + (is_forward? p : -p));
+      } // if
+
+      // Both searches reached j
+      if( auto total {ctx.g_score(j) + other.g_score(j)}; total < best )
+      {
+        best = total;
+        meet = j;
+      } // if
+    } // for: n
+  } // while
+
+  if( meet == -1 ) return {};
+
+  // Forward parents lead back to start, backward parents lead on to end
+  std::deque<Base> path;
+  for (auto c{meet}; c != -1; c = forward.parent(c)) { path.emplace_front(bounds.cell(c)); }
+  for (auto c{backward.parent(meet)}; c != -1; c = backward.parent(c)) { path.emplace_back(bounds.cell(c)); }
+  return path;
+}
+
+template<Grid G, BaseType T1, BaseType T2, typename F1, typename F2, typename F3>
+std::deque<std::pair<int64_t,int64_t>>
+  bidirectional(G const& bounds, T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic)
+{
+  SearchContext<> forward, backward;
+  return bidirectional(bounds, std::forward<T1>(start), std::forward<T2>(end),
+    f_neighbors, f_distance, f_heuristic, forward, backward);
+}
+
 } // namespace celaeno::graph::a_star
@@ -32,14 +32,14 @@
 
 #pragma once
 
-#include <iostream> // std::cerr and std::endl
-#include <optional> // std::optional
 #include <cstdint>  // int64_t, int32_t,...
 #include <utility>  // std::forward
-#include <fplus/fplus.hpp>
+#include <vector>   // std::vector
+#include <algorithm> // std::ranges::sort
+#include <concepts> // std::convertible_to
+#include <thread>   // std::jthread
+#include <stdexcept> // std::out_of_range
 #include <celaeno/graph/views/depth.hpp>
-#include <celaeno/graph/bfs.hpp>
-#include <range/v3/all.hpp>
 
 namespace celaeno::graph::balance
 {
@@ -49,97 +49,454 @@ namespace celaeno::graph::balance
 //
 
 namespace depth = celaeno::graph::views::depth;
-namespace bfs = celaeno::graph::bfs;
-namespace rg = ranges;
-namespace rv = ranges::views;
-namespace fw = fplus::fwd;
 
-template<typename T, typename F1, typename F2, typename F3, typename F4>
-void balance(T root, F1&& pred, F2&& succ, F3&& link, F4&& unlink )
+//
+// Pseudo ids
+//
+
+template<typename A, typename T>
+concept Allocator = requires(A a) { { a() } -> std::convertible_to<T>; };
+
+// Allocators that can tell the k-th id ahead and skip past a block of ids,
+// so that threads can fill disjoint blocks of ids at once
+template<typename A, typename T>
+concept Block = Allocator<A,T> && requires(A a, int64_t k)
 {
-  //
-  // Get the pseudo vertex with the lowest value
-  //
-  auto adj = [&pred,&succ](auto&& v) { return fplus::append(pred(v),succ(v)); };
-  auto counter { fw::apply(bfs::bfs(root,adj), fw::sort(), fw::minimum()) };
+  { std::as_const(a).at(k) } -> std::convertible_to<T>;
+  a.skip(k);
+};
+
+// Ids handed out downwards from the lowest id of the graph, the numbering
+// balance uses unless told otherwise
+template<typename T>
+class Below
+{
+  public:
+    explicit Below(T min) : m_next{min} {}
+    T operator()() noexcept { return --m_next; }
+    T at(int64_t k) const noexcept { return m_next - 1 - static_cast<T>(k); }
+    void skip(int64_t n) noexcept { m_next -= static_cast<T>(n); }
+
+  private:
+    T m_next;
+}; // class: Below
+
+// Ids handed out upwards from the range [first,last) reserved by the
+// caller, which must hold at least Plan::pseudo() ids. Drawing past last
+// throws std::out_of_range instead of running into the ids of the graph.
+template<typename T>
+class Range
+{
+  public:
+    Range(T first, T last) : m_next{first}, m_last{last} {}
+
+    T operator()()
+    {
+      if( size() == 0 ) { throw std::out_of_range{"balance::Range exhausted"}; }
+      return m_next++;
+    }
+
+    T at(int64_t k) const
+    {
+      if( k < 0 || static_cast<size_t>(k) >= size() )
+      {
+        throw std::out_of_range{"balance::Range::at past the range"};
+      } // if
+      return m_next + static_cast<T>(k);
+    }
+
+    void skip(int64_t n)
+    {
+      if( n < 0 || static_cast<size_t>(n) > size() )
+      {
+        throw std::out_of_range{"balance::Range::skip past the range"};
+      } // if
+      m_next += static_cast<T>(n);
+    }
+
+    // Ids left in the range
+    size_t size() const noexcept
+    {
+      return (m_next < m_last)? static_cast<size_t>(m_last - m_next) : 0;
+    }
+
+  private:
+    T m_next;
+    T m_last;
+}; // class: Range
+
+//
+// Edit plan
+//
+
+// How long edges leaving the same vertex get their pseudo vertices: one
+// chain per edge, or a single chain per source that each target taps at
+// the level right above it (a buffer tree of depth one)
+enum class Sharing
+{
+  none,
+  fanout,
+};
+
+// Edge source -> target replaced by a path through length pseudo vertices
+template<typename T>
+struct Chain
+{
+  T source;
+  T target;
+  int64_t length;
+}; // struct: Chain
+
+// Edits that balance the graph. Pseudo ids are drawn in the order of the
+// chains, each chain taking its ids from source to target; by default they
+// count down from counter, the lowest id of the graph. With Sharing::fanout
+// the chains of a source are consecutive and sorted by length, and only the
+// ids that extend the longest chain so far of that source are new.
+template<typename T>
+struct Plan
+{
+  T counter;
+  std::vector<Chain<T>> chains;
+  Sharing sharing{Sharing::none};
+
+  // Whether chain i continues the shared chain of the one before it
+  bool extends(size_t i) const noexcept
+  {
+    return sharing == Sharing::fanout
+      && i > 0 && chains[i-1].source == chains[i].source;
+  }
+
+  // Pseudo vertices chain i adds
+  int64_t added(size_t i) const noexcept
+  {
+    return chains[i].length - (extends(i)? chains[i-1].length : 0);
+  }
+
+  // Number of pseudo vertices
+  int64_t pseudo() const noexcept
+  {
+    int64_t count{0};
+    for (size_t i{0}; i < chains.size(); ++i) { count += added(i); }
+    return count;
+  }
+
+  // Lowest id in the balanced graph with the default ids
+  T min() const noexcept { return counter - static_cast<T>(pseudo()); }
+}; // struct: Plan
+
+// Chains that balance would insert on the levels of view, without touching
+// the graph. Each vertex asks pred once and the id range of the view seeds
+// the pseudo ids. The vertices of the view, grouped by level, are split into
+// one contiguous block per thread and the chains of the blocks gathered in
+// order, so the plan does not depend on the number of threads. pred is
+// called concurrently and must be safe to call from several threads.
+template<typename T, typename F>
+Plan<T> parallel_plan(depth::Flat<T> const& view, F&& pred,
+  Sharing sharing = Sharing::none,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+{
+  Plan<T> result{view.min(), {}, sharing};
 
   //
-  // Build depth-map
+  // Record an edge for each predecessor more than one level above
   //
-  auto [depth_vertex,vertex_depth] =
-    depth::depth(root,std::forward<F1>(pred),std::forward<F2>(succ));
+  auto vertices {view.vertices()};
+  auto n {vertices.size()};
+  threads = std::clamp<size_t>(threads, 1, std::max<size_t>(n, 1));
+  std::vector<std::vector<Chain<T>>> blocks(threads);
+
+  auto worker = [&](size_t t)
+  {
+    auto [begin,end] {std::make_pair(n*t/threads, n*(t+1)/threads)};
+    for (auto i{begin}; i < end; ++i)
+    {
+      auto const& current {vertices[i]};
+      auto level {view.level(current)};
+      for( auto const& p : pred(current) )
+      {
+        auto distance {level-view.level(p)};
+        if( distance > 1 )
+        {
+          blocks[t].push_back({static_cast<T>(p), current, distance-1});
+        } // if
+      } // for
+    } // for: i
+  };
+
+  {
+    std::vector<std::jthread> pool;
+    for (size_t t{1}; t < threads; ++t) { pool.emplace_back(worker, t); }
+    worker(0);
+  } // join
+
+  for (auto const& block : blocks)
+  {
+    result.chains.insert(result.chains.end(), block.begin(), block.end());
+  } // for: block
 
   //
-  // Get the levels indexes
+  // Group the chains of each source, shortest first, so each one extends
+  // the previous
   //
-  auto levels { depth_vertex | rv::keys | rv::unique | rg::to<std::vector> };
+  if( sharing == Sharing::fanout )
+  {
+    std::ranges::stable_sort(result.chains, [](auto const& a, auto const& b)
+      {
+        return std::make_pair(a.source,a.length)
+          < std::make_pair(b.source,b.length);
+      });
+  } // if
+
+  return result;
+} // parallel_plan
+
+// Plan on the longest-path levels of the flat depth view
+template<std::signed_integral T, typename F1, typename F2>
+Plan<T> parallel_plan(T root, F1&& pred, F2&& succ,
+  Sharing sharing = Sharing::none,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+{
+  return parallel_plan(depth::flat(root,pred,succ), pred, sharing, threads);
+} // parallel_plan
+
+template<typename T, typename F>
+Plan<T> plan(depth::Flat<T> const& view, F&& pred,
+  Sharing sharing = Sharing::none)
+{
+  return parallel_plan(view, pred, sharing, 1);
+} // plan
+
+template<std::signed_integral T, typename F1, typename F2>
+Plan<T> plan(T root, F1&& pred, F2&& succ, Sharing sharing = Sharing::none)
+{
+  return parallel_plan(root, pred, succ, sharing, 1);
+} // plan
+
+// Allocators that know how many ids they hold must hold those of the plan,
+// checked before any edit so that a short one leaves the graph untouched
+template<typename T, typename A>
+void check_ids(Plan<T> const& plan, A const& alloc)
+{
+  if constexpr ( requires { { alloc.size() } -> std::convertible_to<size_t>; } )
+  {
+    if( static_cast<size_t>(plan.pseudo()) > alloc.size() )
+    {
+      throw std::out_of_range{"balance: too few ids for the plan"};
+    } // if
+  } // if
+} // check_ids
+
+// Apply a plan through link and unlink, making the same calls as balance,
+// with the pseudo ids drawn from alloc
+template<typename T, Allocator<T> A, typename F1, typename F2>
+void apply(Plan<T> const& plan, A&& alloc, F1&& link, F2&& unlink)
+{
+  check_ids(plan, alloc);
 
   //
-  // Algorithm
+  // Grow one chain per source, each target taps the pseudo vertex on the
+  // level above it and drops its direct edge
   //
-  for (auto const& i : levels)
+  if( plan.sharing == Sharing::fanout )
   {
-    auto range {depth_vertex.equal_range(i)};
-    for( auto it{range.first}; it!=range.second; ++it )
+    T p{};
+    int64_t depth{0};
+    for (size_t i{0}; i < plan.chains.size(); ++i)
     {
-      auto const& current{it->second};
-      // For each predecessor current
-      for( auto p : pred(current) )
+      auto const& [source,target,length] {plan.chains[i]};
+      if( ! plan.extends(i) ) { p = source; depth = 0; }
+      for (; depth < length; ++depth)
       {
-        auto distance{vertex_depth.at(current)-vertex_depth.at(p)};
-        while( distance > 1 )
-        {
-          --counter;
-          //
-          // ↓         ↓
-          // A         B
-          // * ------> *
-          //
-          // Insert pseudo vertex in-between
-          //
-          // A    C    B
-          // * -> * -> *
-          //  \_______/
-          //
-          link(std::make_pair(p,counter));
-          link(std::make_pair(counter,current));
-          //
-          // ↓         ↓
-          // A    C    B
-          // * -> * -> *
-          //  \_______/
-          //
-          // Remove old connection
-          //
-          // A    C    B
-          // * -> * -> *
-          //
-          unlink(std::make_pair(p,current));
-          //
-          // ↓
-          // A    C    B
-          // * -> * -> *
-          //
-          // Update predecessor
-          //      ↓
-          // A    C    B
-          // * -> * -> *
-          //
-          p = counter;
-          //
-          // If the distance 'd' is still greater than one, more pseudo
-          // vertices need to be inserted in-between C and B.
-          // A    C    B
-          // * -> * -> *
-          //      |____|
-          //        d
-          //
-          --distance;
-        } // while
-      } // for
-    } // for
+        auto c {static_cast<T>(alloc())};
+        link(std::make_pair(p,c));
+        p = c;
+      } // for: depth
+      link(std::make_pair(p,target));
+      unlink(std::make_pair(source,target));
+    } // for: i
+    return;
+  } // if
+
+  for (auto const& [source,target,length] : plan.chains)
+  {
+    auto p {source};
+    for (int64_t k{0}; k < length; ++k)
+    {
+      auto counter {static_cast<T>(alloc())};
+      //
+      // ↓         ↓
+      // A         B
+      // * ------> *
+      //
+      // Insert pseudo vertex in-between
+      //
+      // A    C    B
+      // * -> * -> *
+      //  \_______/
+      //
+      link(std::make_pair(p,counter));
+      link(std::make_pair(counter,target));
+      //
+      // Remove old connection, more pseudo vertices go in-between C and B
+      // while the chain is not complete
+      //
+      // A    C    B
+      // * -> * -> *
+      //
+      unlink(std::make_pair(p,target));
+      p = counter;
+    } // for: k
+  } // for: chains
+} // apply
+
+template<typename T, typename F1, typename F2>
+void apply(Plan<T> const& plan, F1&& link, F2&& unlink)
+{
+  apply(plan, Below<T>{plan.counter}, link, unlink);
+} // apply
+
+// Edges not replaced by a chain
+template<typename T, typename E>
+std::vector<std::pair<T,T>> survivors(Plan<T> const& plan, E&& edges)
+{
+  std::vector<std::pair<T,T>> replaced;
+  replaced.reserve(plan.chains.size());
+  for (auto const& c : plan.chains)
+  {
+    replaced.emplace_back(c.source, c.target);
+  } // for: c
+  std::ranges::sort(replaced);
+
+  std::vector<std::pair<T,T>> result;
+  for (auto const& e : edges)
+  {
+    std::pair<T,T> edge{static_cast<T>(e.first), static_cast<T>(e.second)};
+    if( ! std::ranges::binary_search(replaced, edge) )
+    {
+      result.push_back(edge);
+    } // if
+  } // for: edges
+
+  return result;
+} // survivors
+
+// Edges of the balanced graph in one pass: edges replaced by a chain are
+// dropped and the edges of the chains appended. The default pseudo ids are
+// negative for graphs rooted at zero, which csr::Graph stores from its
+// lowest id; draw them from a Range past the highest id to keep the ids of
+// the balanced graph from zero.
+template<typename T, typename E, Allocator<T> A>
+std::vector<std::pair<T,T>> expand(Plan<T> const& plan, E&& edges, A&& alloc)
+{
+  check_ids(plan, alloc);
+  auto result {survivors(plan, std::forward<E>(edges))};
+
+  // Same walk as apply, keeping only the edges that survive
+  T p{};
+  int64_t depth{0};
+  for (size_t i{0}; i < plan.chains.size(); ++i)
+  {
+    auto const& [source,target,length] {plan.chains[i]};
+    if( ! plan.extends(i) ) { p = source; depth = 0; }
+    for (; depth < length; ++depth)
+    {
+      auto c {static_cast<T>(alloc())};
+      result.emplace_back(p, c);
+      p = c;
+    } // for: depth
+    result.emplace_back(p, target);
+  } // for: i
+
+  return result;
+} // expand
+
+template<typename T, typename E>
+std::vector<std::pair<T,T>> expand(Plan<T> const& plan, E&& edges)
+{
+  return expand(plan, std::forward<E>(edges), Below<T>{plan.counter});
+} // expand
+
+// expand with the chains split among threads. The position of each chain
+// in the output and its block of ids follow from a prefix sum of the ids
+// each chain adds, so the result and the ids drawn from alloc are the same
+// as those of expand.
+template<typename T, typename E, Block<T> A>
+std::vector<std::pair<T,T>> parallel_expand(Plan<T> const& plan, E&& edges,
+  A&& alloc,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+{
+  check_ids(plan, alloc);
+  auto result {survivors(plan, std::forward<E>(edges))};
+  auto const& chains {plan.chains};
+
+  // Offset of the first id each chain adds
+  std::vector<int64_t> first(chains.size()+1, 0);
+  for (size_t i{0}; i < chains.size(); ++i)
+  {
+    first[i+1] = first[i] + plan.added(i);
   } // for: i
 
+  auto base {result.size()};
+  result.resize(base + static_cast<size_t>(first.back()) + chains.size());
+  threads = std::clamp<size_t>(threads, 1, std::max<size_t>(chains.size(), 1));
+
+  auto worker = [&](size_t t)
+  {
+    auto n {chains.size()};
+    auto [begin,end] {std::make_pair(n*t/threads, n*(t+1)/threads)};
+    for (auto i{begin}; i < end; ++i)
+    {
+      // A shared chain continues from the last id of the chain before it
+      auto slot {base + static_cast<size_t>(first[i]) + i};
+      auto p {plan.extends(i)?
+        static_cast<T>(alloc.at(first[i]-1)) : chains[i].source};
+      for (auto k{first[i]}; k < first[i+1]; ++k)
+      {
+        auto c {static_cast<T>(alloc.at(k))};
+        result[slot++] = {p, c};
+        p = c;
+      } // for: k
+      result[slot] = {p, chains[i].target};
+    } // for: i
+  };
+
+  {
+    std::vector<std::jthread> pool;
+    for (size_t t{1}; t < threads; ++t) { pool.emplace_back(worker, t); }
+    worker(0);
+  } // join
+
+  alloc.skip(first.back());
+  return result;
+} // parallel_expand
+
+template<typename T, typename E>
+std::vector<std::pair<T,T>> parallel_expand(Plan<T> const& plan, E&& edges,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+{
+  return parallel_expand(plan, std::forward<E>(edges),
+    Below<T>{plan.counter}, threads);
+} // parallel_expand
+
+//
+// Algorithm
+//
+
+template<typename T, typename F1, typename F2, typename F3, typename F4>
+void balance(T root, F1&& pred, F2&& succ, F3&& link, F4&& unlink,
+  Sharing sharing = Sharing::none)
+{
+  apply(plan(root,pred,succ,sharing), link, unlink);
+} // balance
+
+// Balance with the pseudo ids drawn from alloc, e.g. a Range of ids the
+// caller reserved
+template<typename T, typename F1, typename F2, typename F3, typename F4,
+  Allocator<T> A>
+void balance(T root, F1&& pred, F2&& succ, F3&& link, F4&& unlink, A&& alloc,
+  Sharing sharing = Sharing::none)
+{
+  apply(plan(root,pred,succ,sharing), alloc, link, unlink);
 } // balance
 
 } // namespace celaeno::graph::balance
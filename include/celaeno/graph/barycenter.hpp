@@ -8,6 +8,8 @@
 #include <fplus/fplus.hpp>
 #include <range/v3/all.hpp>
 #include <concepts>
+#include <ranges>
+#include <tuple>
 #include <type_traits>
 
 namespace celaeno::graph::barycenter
@@ -64,6 +66,27 @@ namespace celaeno::graph::barycenter
       {Arithmetic<decltype( v.at(int32_t{}) )>};
     };
 
+  // Compressed rows with the column indices of the nonzero cells,
+  // e.g. matrix_realization::Sparse
+  template<typename M>
+  concept SparseMatrix =
+    requires(M m)
+    {
+      { m.rows() } -> std::convertible_to<size_t>;
+      { m.row(size_t{}) } -> std::ranges::input_range;
+    };
+
+  // Sparse vector as (index, weight) pairs, indices are zero-based
+  template<typename P>
+  concept Pairs =
+    std::ranges::input_range<P>
+  &&
+    requires(std::ranges::range_value_t<P> p)
+    {
+      {std::get<0>(p)};
+      {std::get<1>(p)};
+    };
+
   //
   // Algorithms
   //
@@ -83,4 +106,35 @@ namespace celaeno::graph::barycenter
     return (b != 0)? static_cast<double>(a)/b : 0;
   } // function: run
 
+  // Same weighting as run, the entry at index i counts as position i+1,
+  // without materializing the zeros of the dense vector
+  template<Pairs P>
+  double sparse(P&& p)
+  {
+    double a{0}, b{0};
+    for (auto const& e : p)
+    {
+      auto [i,w] {std::make_pair(static_cast<double>(std::get<0>(e)), static_cast<double>(std::get<1>(e)))};
+      a += (i+1)*w;
+      b += w;
+    } // for: e
+
+    return (b != 0)? a/b : 0;
+  } // function: sparse
+
+  // Barycenter of row r of a sparse incidence matrix, as run over the
+  // dense row
+  template<SparseMatrix M>
+  double run(M const& m, size_t r)
+  {
+    double a{0}, b{0};
+    for (auto const& c : m.row(r))
+    {
+      a += static_cast<double>(c)+1;
+      b += 1;
+    } // for: c
+
+    return (b != 0)? a/b : 0;
+  } // function: run
+
 } // namespace celaeno::graph::barycenter
@@ -39,9 +39,13 @@
 #include <queue>
 #include <set>
 #include <tuple>
+#include <optional>
 #include <concepts>
+#include <ranges>
 #include <fplus/fplus.hpp>
 #include <range/v3/all.hpp>
+#include <celaeno/graph/visited.hpp>
+#include <celaeno/graph/traversal.hpp>
 
 namespace celaeno::graph::bfs
 {
@@ -50,6 +54,7 @@ namespace celaeno::graph::bfs
 // Aliases
 //
 namespace rg = ranges;
+namespace traversal = celaeno::graph::traversal;
 namespace fw = fplus::fwd;
 
 
@@ -57,7 +62,7 @@ namespace fw = fplus::fwd;
 // Concepts
 //
 template<typename T>
-concept Iterable = requires{ std::input_iterator<T> && std::incrementable<T>; };
+concept Iterable = std::ranges::input_range<T>;
 
 template<typename T>
 concept SignedIntegral = std::signed_integral<T>;
@@ -71,15 +76,16 @@ concept Fc = requires(T t){ {t(int64_t{})} -> std::same_as<bool>; };
 //
 // Algorithm
 //
-template< SignedIntegral T, Fn F1, Fc F2 = std::function<bool(int64_t)> >
-std::vector<T> bfs(T root, F1&& adj, F2&& cb = [](auto&&){return false;})
+// The visited state is used as given, pass a visited::Stamp (or any other
+// policy) by reference to reuse it across traversals, clearing it in-between.
+//
+template< SignedIntegral T, Fn F1, Fc F2 = std::function<bool(int64_t)>,
+  visited::Visited<T> V = visited::Hash<T> >
+std::vector<T> bfs(T root, F1&& adj, F2&& cb = [](auto&&){return false;}, V&& visited = V{})
 {
   // Queue of vertices
   std::queue<T> queue;
 
-  // Visited vertices
-  std::set<T> visited; // Using std::set for log(n) query
-
   // Result that contains all the visited vertices
   // until callback returns true
   std::vector<T> result;
@@ -101,13 +107,11 @@ std::vector<T> bfs(T root, F1&& adj, F2&& cb = [](auto&&){return false;})
     // Mark as visited
     visited.insert(vertex);
 
-    // Get the adjacent vertices
-    // Remove the visited ones
-    auto is_visited = [&visited](auto&& v){return visited.contains(v);};
-    auto not_visited {fw::apply(adj(vertex), fw::drop_if(is_visited))};
-
-    // Insert non-visited into the queue
-    rg::for_each(not_visited, [&queue](auto&& v){ queue.push(v); });
+    // Insert the non-visited adjacent vertices into the queue
+    for (auto&& v : adj(vertex))
+    {
+      if( ! visited.contains(v) ) { queue.push(v); }
+    }
 
     // Execute callback on current vertex
     if ( cb(vertex) ) return result;
@@ -115,4 +119,54 @@ std::vector<T> bfs(T root, F1&& adj, F2&& cb = [](auto&&){return false;})
   return result;
 }
 
+//
+// Lazy algorithm
+//
+// Yields the vertices in the same order as bfs; the neighbors of a vertex are
+// only requested once the view moves past it.
+//
+template<SignedIntegral T, Fn F, visited::Visited<T> V>
+struct Step
+{
+  F adj;
+  V visited;
+  std::queue<T> queue{};
+  std::optional<T> last{};
+
+  // Expand the last vertex and move to the next non-visited one
+  std::optional<T> operator()()
+  {
+    if( last )
+    {
+      for (auto&& v : adj(*last))
+      {
+        if( ! visited.contains(v) ) { queue.push(v); }
+      }
+      last.reset();
+    } // if
+
+    while( ! queue.empty() )
+    {
+      auto vertex {queue.front()}; queue.pop();
+      if( visited.contains(vertex) ) continue;
+      visited.insert(vertex);
+      last = vertex;
+      break;
+    } // while
+    return last;
+  }
+}; // struct: Step
+
+template<SignedIntegral T, Fn F, visited::Visited<T> V>
+using Lazy = traversal::Lazy<T,Step<T,F,V>>;
+
+// Lvalue callables and visited states are referenced, not copied
+template< SignedIntegral T, Fn F, visited::Visited<T> V = visited::Hash<T> >
+Lazy<T,F,V> lazy(T root, F&& adj, V&& visited = V{})
+{
+  Step<T,F,V> step{std::forward<F>(adj), std::forward<V>(visited)};
+  step.queue.push(root);
+  return Lazy<T,F,V>{std::move(step)};
+}
+
 } // namespace celaeno::graph::bfs
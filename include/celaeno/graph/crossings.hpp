@@ -31,6 +31,15 @@
 
 #pragma once
 
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <ranges>
+#include <iostream>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
 namespace celaeno::graph::crossings
 {
 //
@@ -57,7 +66,7 @@ concept Arithmetic =
   };
 
 template<typename M>
-concept Matrix =
+concept DenseMatrix =
   Iterable<M>
 &&
   requires(M m)
@@ -71,56 +80,187 @@ concept Matrix =
     {Arithmetic<decltype( m.at(int32_t{}).at(int32_t{}) )>};
   };
 
+// Range of (north position, south position) pairs, optionally followed by
+// a weight
+template<typename E>
+concept EdgeList =
+  std::ranges::input_range<E>
+&&
+  requires(std::ranges::range_value_t<E> e)
+  {
+    {std::get<0>(e)} -> std::convertible_to<int64_t>;
+    {std::get<1>(e)} -> std::convertible_to<int64_t>;
+  };
+
+// Rows such as std::array<int32_t,3> read both as a matrix row of 2 or 3
+// columns and as an edge with an optional weight
+template<typename R>
+concept Ambiguous =
+  requires(R r)
+  {
+    {r.at(size_t{})};
+    requires std::tuple_size<R>::value == 2 || std::tuple_size<R>::value == 3;
+  };
+
+// Incidence matrix, rows that also read as edges must be tagged as_matrix
+template<typename M>
+concept Matrix =
+  DenseMatrix<M>
+&&
+  (! Ambiguous<std::remove_cvref_t<decltype(std::declval<M&>().at(int32_t{}))>>);
+
+// Compressed rows with the column indices of the nonzero cells,
+// e.g. matrix_realization::Sparse
+template<typename M>
+concept SparseMatrix =
+  requires(M m)
+  {
+    { m.rows() } -> std::convertible_to<size_t>;
+    { m.cols() } -> std::convertible_to<size_t>;
+    { m.row(size_t{}) } -> std::ranges::input_range;
+  };
+
+// Edge list that is not also an incidence matrix, rows that also read as
+// matrix rows must be tagged as_edges
+template<typename E>
+concept Edges =
+  EdgeList<E>
+&&
+  (! Matrix<E>)
+&&
+  (! Ambiguous<std::ranges::range_value_t<E>>);
+
+//
+// Tags
+//
+
+// Reading of a range of std::array<T,2> or std::array<T,3>, which is both
+// an edge list and an incidence matrix with 2 or 3 columns
+struct AsEdges { explicit AsEdges() = default; };
+struct AsMatrix { explicit AsMatrix() = default; };
+inline constexpr AsEdges as_edges{};
+inline constexpr AsMatrix as_matrix{};
+
 //
 // Algorithm
 //
-template<Matrix M>
-int64_t run(M const& m)
+
+// Barth-Jünger-Mutzel accumulator tree count over (north, south, weight)
+// triples, p and q are the sizes of the north and south layers. The tree is
+// built over the smaller layer, since swapping the layers keeps the count.
+inline int64_t count(std::vector<std::tuple<int64_t,int64_t,int64_t>>& edges, int64_t p, int64_t q)
 {
-  if( m.size() == 0)
+  // Positions index the leaves of the tree
+  for ([[maybe_unused]] auto const& [n,s,w] : edges) { assert(0 <= n && n < p && 0 <= s && s < q); }
+
+  if( q > p )
   {
-    std::cerr << "Empty incidence matrix" << std::endl;
-  }
+    for (auto& [n,s,w] : edges) { std::swap(n,s); }
+    std::swap(p,q);
+  } // if
 
-  // Assumption that level i has its vertices in the
-  // rows and level i+1 has its vertices in the columns
+  // Edges sorted by north then south position, the south positions
+  // then appear in the order they are inserted in the tree
+  std::ranges::sort(edges);
 
-  // Number of vertices in the ith layer
-  // is equal to the number of rows
-  auto p{m.size()};
+  // Complete binary tree with a leaf per south position
+  int64_t first{1};
+  while( first < q ) { first *= 2; }
+  std::vector<int64_t> tree(static_cast<size_t>(2*first-1), 0);
+  --first;
 
-  // Number of vertices in the i+1th layer
-  // is equal to the number of columns, take a
-  // column and get its size, they should be
-  // equal
-  auto q{m.at(0).size()};
+  int64_t crossings{0};
+  for (auto const& [n,s,w] : edges)
+  {
+    // Insert the edge and accumulate the weight of the earlier
+    // edges ending to the right of it
+    auto index {s + first};
+    tree[static_cast<size_t>(index)] += w;
+    while( index > 0 )
+    {
+      if( index % 2 ) { crossings += w * tree[static_cast<size_t>(index+1)]; }
+      index = (index-1) / 2;
+      tree[static_cast<size_t>(index)] += w;
+    } // while
+  } // for: edge
 
-  int64_t crossings{};
+  return crossings;
+} // function: count
 
-  try
+// Crossings of a sparse edge list, positions are zero-based
+template<EdgeList E>
+int64_t run(AsEdges, E const& edges)
+{
+  std::vector<std::tuple<int64_t,int64_t,int64_t>> weighted;
+  int64_t p{0}, q{0};
+  for (auto const& e : edges)
   {
-    for (size_t j = 0; j < p-1; j++)
+    auto n {static_cast<int64_t>(std::get<0>(e))};
+    auto s {static_cast<int64_t>(std::get<1>(e))};
+    int64_t w{1};
+    if constexpr ( std::tuple_size_v<std::ranges::range_value_t<E>> > 2 )
     {
-      for (size_t k = j+1; k < p; k++)
-      {
-        for (size_t a = 0; a < q-1; a++)
-        {
-          for (size_t b = a+1; b < q; b++)
-          {
-            crossings += m.at(j).at(b) * m.at(k).at(a);
-          } // for: b
-        } // for: a
-      } // for: k
-    } // for: j
-
-  } // try
-  catch (std::exception const& e)
+      w = static_cast<int64_t>(std::get<2>(e));
+    } // if
+    weighted.emplace_back(n,s,w);
+    p = std::max(p,n+1);
+    q = std::max(q,s+1);
+  } // for: e
+
+  return count(weighted, p, q);
+} // function: run
+
+template<Edges E>
+int64_t run(E const& edges)
+{
+  return run(as_edges, edges);
+} // function: run
+
+// Crossings of an incidence matrix, assumption that level i has its
+// vertices in the rows and level i+1 has its vertices in the columns
+template<DenseMatrix M>
+int64_t run(AsMatrix, M const& m)
+{
+  if( m.size() == 0)
+  {
+    std::cerr << "Empty incidence matrix" << std::endl;
+    return 0;
+  }
+
+  std::vector<std::tuple<int64_t,int64_t,int64_t>> edges;
+  int64_t p{0}, q{0};
+  for (auto const& row : m)
   {
-    std::cerr << "Degenerate incidence matrix" << std::endl;
-  } // catch
+    int64_t j{0};
+    for (auto const& w : row)
+    {
+      if( w != 0 ) { edges.emplace_back(p, j, static_cast<int64_t>(w)); }
+      ++j;
+    } // for: w
+    q = std::max(q,j);
+    ++p;
+  } // for: row
 
-  return crossings;
+  return count(edges, p, q);
+} // function: run
+
+template<Matrix M>
+int64_t run(M const& m)
+{
+  return run(as_matrix, m);
+} // function: run
+
+// Crossings of a sparse incidence matrix, one unit edge per stored cell
+template<SparseMatrix M>
+int64_t run(M const& m)
+{
+  std::vector<std::tuple<int64_t,int64_t,int64_t>> edges;
+  for (size_t r{0}; r < m.rows(); ++r)
+  {
+    for (auto const& c : m.row(r)) { edges.emplace_back(r, c, 1); }
+  } // for: r
 
+  return count(edges, static_cast<int64_t>(m.rows()), static_cast<int64_t>(m.cols()));
 } // function: run
 
 } // namespace celaeno::graph::crossings
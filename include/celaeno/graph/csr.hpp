@@ -0,0 +1,198 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : csr
+// @created     : Saturday Oct 17, 2026 03:14:39 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <vector>
+#include <span>
+#include <ranges>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <type_traits>
+
+namespace celaeno::graph::csr
+{
+
+//
+// Concepts
+//
+template<typename T>
+concept Edge =
+  requires(T t)
+  {
+    { t.first  } -> std::convertible_to<int64_t>;
+    { t.second } -> std::convertible_to<int64_t>;
+  };
+
+// Walked once to size the graph, once to count degrees and once to scatter
+template<typename T>
+concept Edges =
+  std::ranges::forward_range<T> && Edge<std::ranges::range_value_t<T>>;
+
+//
+// Compressed sparse row graph
+//
+// Immutable directed graph over the vertex ids [min(),min()+size()), where
+// min() is zero unless the edges hold negative ids (e.g. balance pseudo
+// vertices), in which case it is the lowest of them. The successors,
+// predecessors and adjacent vertices (predecessors followed by successors) of
+// each vertex are stored contiguously, queries return views into that storage.
+// As in taygete::graph::Graph, repeated edges are stored once, each row holds
+// distinct ids in increasing order. Ids outside the range have no neighbors.
+//
+template<std::signed_integral T = int64_t>
+class Graph
+{
+  public:
+    using vertex_type = T;
+    using neighbors_type = std::span<T const>;
+
+    Graph() = default;
+
+    template<Edges E>
+    explicit Graph(E&& edges)
+    {
+      // Get the range of vertex ids
+      T first{0}, last{-1};
+      for (auto const& e : edges)
+      {
+        auto [u,v] {std::make_pair(static_cast<T>(e.first), static_cast<T>(e.second))};
+        first = std::min({first, u, v});
+        last = std::max({last, u, v});
+      } // for: edges
+      m_base = first;
+      auto n {(last < first)? size_t{0} : index(last)+1};
+
+      // Count the degree of each vertex
+      m_succ.offsets.assign(n+1, 0);
+      m_pred.offsets.assign(n+1, 0);
+      for (auto const& e : edges)
+      {
+        ++m_succ.offsets[index(static_cast<T>(e.first))+1];
+        ++m_pred.offsets[index(static_cast<T>(e.second))+1];
+      } // for: edges
+
+      // Offsets are the prefix sum of the degrees
+      std::partial_sum(m_succ.offsets.begin(), m_succ.offsets.end(), m_succ.offsets.begin());
+      std::partial_sum(m_pred.offsets.begin(), m_pred.offsets.end(), m_pred.offsets.begin());
+
+      // Scatter the edges into their rows
+      m_succ.targets.resize(m_succ.offsets.back());
+      m_pred.targets.resize(m_pred.offsets.back());
+      std::vector<size_t> fill_succ(m_succ.offsets.begin(), m_succ.offsets.end()-1);
+      std::vector<size_t> fill_pred(m_pred.offsets.begin(), m_pred.offsets.end()-1);
+      for (auto const& e : edges)
+      {
+        auto [u,v] {std::make_pair(static_cast<T>(e.first), static_cast<T>(e.second))};
+        m_succ.targets[fill_succ[index(u)]++] = v;
+        m_pred.targets[fill_pred[index(v)]++] = u;
+      } // for: edges
+
+      // Drop the repeated edges
+      m_succ.deduplicate();
+      m_pred.deduplicate();
+
+      // Adjacency is the concatenation of both rows
+      m_adj.offsets.assign(n+1, 0);
+      m_adj.targets.reserve(m_succ.targets.size() + m_pred.targets.size());
+      for (size_t i{0}; i < n; ++i)
+      {
+        auto [p,s] {std::make_pair(m_pred.row(i), m_succ.row(i))};
+        m_adj.targets.insert(m_adj.targets.end(), p.begin(), p.end());
+        m_adj.targets.insert(m_adj.targets.end(), s.begin(), s.end());
+        m_adj.offsets[i+1] = m_adj.targets.size();
+      } // for: i
+    } // constructor
+
+    // Number of vertex ids
+    size_t size() const noexcept { return m_succ.offsets.empty()? 0 : m_succ.offsets.size()-1; }
+
+    // Lowest vertex id
+    T min() const noexcept { return m_base; }
+
+    // Number of directed edges
+    size_t edge_count() const noexcept { return m_succ.targets.size(); }
+
+    neighbors_type succ(T v) const noexcept { return m_succ.row(index(v)); }
+    neighbors_type pred(T v) const noexcept { return m_pred.row(index(v)); }
+    neighbors_type adj(T v) const noexcept  { return m_adj.row(index(v)); }
+
+  private:
+    struct Rows
+    {
+      std::vector<size_t> offsets{};
+      std::vector<T> targets{};
+
+      neighbors_type row(size_t i) const noexcept
+      {
+        if( offsets.empty() || i >= offsets.size()-1 ) return {};
+        return neighbors_type{targets.data()+offsets[i], offsets[i+1]-offsets[i]};
+      }
+
+      // Sort each row and keep one copy of each id, compacting the rows
+      // towards the front of targets
+      void deduplicate()
+      {
+        size_t out{0};
+        for (size_t i{0}; i+1 < offsets.size(); ++i)
+        {
+          auto first {targets.begin()+static_cast<int64_t>(offsets[i])};
+          auto last {targets.begin()+static_cast<int64_t>(offsets[i+1])};
+          std::sort(first, last);
+          last = std::unique(first, last);
+          offsets[i] = out;
+          out = static_cast<size_t>(std::move(first, last, targets.begin()+static_cast<int64_t>(out)) - targets.begin());
+        } // for: i
+        if( ! offsets.empty() ) { offsets.back() = out; }
+        targets.resize(out);
+      }
+    };
+
+    // Row of v, ids below the base wrap past every row
+    size_t index(T v) const noexcept
+    {
+      using U = std::make_unsigned_t<T>;
+      return static_cast<size_t>(static_cast<U>(static_cast<U>(v) - static_cast<U>(m_base)));
+    }
+
+    T m_base{0};
+    Rows m_succ{};
+    Rows m_pred{};
+    Rows m_adj{};
+}; // class: Graph
+
+template<Edges E>
+Graph(E&&) -> Graph<int64_t>;
+
+} // namespace celaeno::graph::csr
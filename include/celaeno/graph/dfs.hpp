@@ -32,11 +32,15 @@
 #pragma once
 
 #include <stack>
+#include <optional>
 #include <unordered_map>
 #include <type_traits> // std::remove_reference
 #include <concepts>
+#include <ranges>
 #include <fplus/fplus.hpp>
 #include <range/v3/all.hpp>
+#include <celaeno/graph/visited.hpp>
+#include <celaeno/graph/traversal.hpp>
 
 namespace celaeno::graph::dfs
 {
@@ -45,6 +49,7 @@ namespace celaeno::graph::dfs
 //
 
 namespace rg = ranges;
+namespace traversal = celaeno::graph::traversal;
 namespace fw = fplus::fwd;
 
 
@@ -52,7 +57,7 @@ namespace fw = fplus::fwd;
 // concepts
 //
 template<typename T>
-concept Iterable = requires{ std::input_iterator<T> && std::incrementable<T>; };
+concept Iterable = std::ranges::input_range<T>;
 
 template<typename T>
 concept SignedIntegral = std::signed_integral<T>;
@@ -66,15 +71,15 @@ concept Fc = requires(T t){ {t(int64_t{})} -> std::same_as<bool>; };
 //
 // Algorithm
 //
-template<SignedIntegral T, Fn F1, Fc F2 = std::function<bool(int64_t)>>
-std::vector<T> dfs(T&& root, F1&& adj, F2&& cb = [](auto&&){return false;})
+// The visited state is used as given, see bfs::bfs.
+//
+template<SignedIntegral T, Fn F1, Fc F2 = std::function<bool(int64_t)>,
+  visited::Visited<T> V = visited::Hash<T>>
+std::vector<T> dfs(T&& root, F1&& adj, F2&& cb = [](auto&&){return false;}, V&& visited = V{})
 {
   // Stack of vertices
   std::stack<T> stack;
 
-  // Map of visited vertices
-  std::unordered_map<T,bool> visited;
-
   // Result that contains all visited vertices
   // until callback returns true
   std::vector<T> result;
@@ -94,15 +99,13 @@ std::vector<T> dfs(T&& root, F1&& adj, F2&& cb = [](auto&&){return false;})
     result.push_back(vertex);
 
     // Mark the vertex as visited
-    visited.emplace(vertex,true);
-
-    // Get the adjacent vertices
-    // Remove the visited ones
-    auto is_visited = [&visited](auto&& v){ return visited.contains(v); };
-    auto not_visited {fw::apply(adj(vertex), fw::drop_if(is_visited))};
+    visited.insert(vertex);
 
-    // Insert the unvisited vertices into the stack
-    rg::for_each(not_visited, [&stack](auto&& v){ stack.push(v); });
+    // Insert the unvisited adjacent vertices into the stack
+    for (auto&& v : adj(vertex))
+    {
+      if( ! visited.contains(v) ) { stack.push(v); }
+    }
 
     // Execute callback on current vertex
     if( cb(vertex) ) return result;
@@ -110,5 +113,54 @@ std::vector<T> dfs(T&& root, F1&& adj, F2&& cb = [](auto&&){return false;})
   return result;
 } // dfs
 
+//
+// Lazy algorithm
+//
+// Yields the vertices in the same order as dfs; the neighbors of a vertex are
+// only requested once the view moves past it.
+//
+template<SignedIntegral T, Fn F, visited::Visited<T> V>
+struct Step
+{
+  F adj;
+  V visited;
+  std::stack<T> stack{};
+  std::optional<T> last{};
+
+  // Expand the last vertex and move to the next non-visited one
+  std::optional<T> operator()()
+  {
+    if( last )
+    {
+      for (auto&& v : adj(*last))
+      {
+        if( ! visited.contains(v) ) { stack.push(v); }
+      }
+      last.reset();
+    } // if
+
+    while( ! stack.empty() )
+    {
+      auto vertex {stack.top()}; stack.pop();
+      if( visited.contains(vertex) ) continue;
+      visited.insert(vertex);
+      last = vertex;
+      break;
+    } // while
+    return last;
+  }
+}; // struct: Step
+
+template<SignedIntegral T, Fn F, visited::Visited<T> V>
+using Lazy = traversal::Lazy<T,Step<T,F,V>>;
+
+// Lvalue callables and visited states are referenced, not copied
+template<SignedIntegral T, Fn F, visited::Visited<T> V = visited::Hash<T>>
+Lazy<T,F,V> lazy(T root, F&& adj, V&& visited = V{})
+{
+  Step<T,F,V> step{std::forward<F>(adj), std::forward<V>(visited)};
+  step.stack.push(root);
+  return Lazy<T,F,V>{std::move(step)};
+}
 
 } // namespace celaeno::graph::dfs
@@ -0,0 +1,430 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : jps
+// @created     : Saturday Oct 17, 2026 03:45:46 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <deque>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <type_traits>
+#include <celaeno/graph/a-star.hpp>
+
+namespace celaeno::graph::jps
+{
+//
+// Aliases
+//
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+using Cell = std::pair<int64_t,int64_t>;
+
+//
+// Types
+//
+
+// Moves allowed on the grid, diagonal moves never cut the corner of a
+// blocked cell
+enum class Connectivity
+{
+  four,
+  eight,
+};
+
+//
+// Helpers
+//
+
+inline Cell operator+(Cell const& a, Cell const& b) noexcept { return {a.first+b.first, a.second+b.second}; }
+
+inline int64_t sign(int64_t v) noexcept { return (v > 0) - (v < 0); }
+
+// Cost of a straight or diagonal segment between two cells
+inline float64_t segment(Cell const& a, Cell const& b, Connectivity c) noexcept
+{
+  auto [dx,dy] {std::make_pair(std::abs(b.first-a.first), std::abs(b.second-a.second))};
+  if( c == Connectivity::four ) { return static_cast<float64_t>(dx+dy); }
+  return static_cast<float64_t>(std::max(dx,dy) - std::min(dx,dy)) + std::sqrt(2.) * static_cast<float64_t>(std::min(dx,dy));
+}
+
+//
+// Straight jumps
+//
+
+// Walks the grid cell by cell, queries f_blocked on the fly
+template<typename F>
+class Walk
+{
+  public:
+    Walk(a_star::Bounds const& bounds, F& blocked, Connectivity connectivity)
+      : m_bounds{bounds}
+      , m_blocked{blocked}
+      , m_connectivity{connectivity}
+    {}
+
+    a_star::Bounds const& bounds() const noexcept { return m_bounds; }
+    Connectivity connectivity() const noexcept { return m_connectivity; }
+
+    bool free(Cell const& c) const { return m_bounds.contains(c) && ! m_blocked(c); }
+
+    // First jump point or goal met walking from c along d, d is (±1,0)
+    // or (0,±1)
+    std::optional<Cell> straight(Cell c, Cell const& d, Cell const& goal) const
+    {
+      while( true )
+      {
+        c = c + d;
+        if( ! free(c) ) return std::nullopt;
+        if( c == goal ) return c;
+        if( forced(*this, c, d) ) return c;
+        // Moving along the second coordinate of a four-connected grid,
+        // cells that lead to a jump point sideways are jump points
+        if( m_connectivity == Connectivity::four && d.second != 0
+          && (straight(c, {1,0}, goal) || straight(c, {-1,0}, goal)) ) return c;
+      } // while
+    }
+
+  private:
+    a_star::Bounds m_bounds;
+    F& m_blocked;
+    Connectivity m_connectivity;
+}; // class: Walk
+
+// A cell entered along a straight direction d is a jump point when a side
+// cell is free while the side cell behind it is blocked
+template<typename G>
+bool forced(G const& grid, Cell const& c, Cell const& d)
+{
+  auto [dx,dy] {d};
+  if( dx != 0 )
+  {
+    return (grid.free({c.first,c.second-1}) && ! grid.free({c.first-dx,c.second-1}))
+      || (grid.free({c.first,c.second+1}) && ! grid.free({c.first-dx,c.second+1}));
+  } // if
+  return (grid.free({c.first-1,c.second}) && ! grid.free({c.first-1,c.second-dy}))
+    || (grid.free({c.first+1,c.second}) && ! grid.free({c.first+1,c.second-dy}));
+}
+
+// JPS+ preprocessing: a snapshot of the obstacles and, for every cell and
+// straight direction, the number of steps to the next jump point (positive)
+// or to the last free cell before an obstacle (zero or negative). Built once
+// per obstacle map, straight jumps then take constant time.
+class Plus
+{
+  public:
+    template<typename F>
+    Plus(a_star::Bounds const& bounds, F&& blocked, Connectivity connectivity = Connectivity::eight)
+      : m_bounds{bounds}
+      , m_connectivity{connectivity}
+      , m_free(bounds.size())
+      , m_jump(bounds.size(), {0,0,0,0})
+    {
+      for (size_t i{0}; i < m_free.size(); ++i) { m_free[i] = ! blocked(bounds.cell(static_cast<int64_t>(i))); }
+
+      // Distances along the first coordinate, then along the second
+      // (which on four-connected grids depend on the first ones)
+      for (size_t k{0}; k < 4; ++k)
+      {
+        auto d {s_directions[k]};
+        auto [rows,cols] {std::make_pair(bounds.rows(), bounds.cols())};
+        auto [outer,inner] {(d.first != 0)? std::make_pair(cols,rows) : std::make_pair(rows,cols)};
+        for (int64_t o{0}; o < outer; ++o)
+        {
+          // Walk each line against d so the next cell is already known
+          for (int64_t step{0}; step < inner; ++step)
+          {
+            auto j {(d.first + d.second > 0)? inner-1-step : step};
+            Cell c {(d.first != 0)? Cell{bounds.min.first+j, bounds.min.second+o}
+              : Cell{bounds.min.first+o, bounds.min.second+j}};
+            auto n {c + d};
+            auto& v {m_jump[static_cast<size_t>(bounds.index(c))][k]};
+            if( ! free(n) ) { v = 0; continue; }
+            if( jump_point(n, d) ) { v = 1; continue; }
+            auto w {m_jump[static_cast<size_t>(bounds.index(n))][k]};
+            v = (w > 0)? w+1 : w-1;
+          } // for: step
+        } // for: o
+      } // for: k
+    }
+
+    a_star::Bounds const& bounds() const noexcept { return m_bounds; }
+    Connectivity connectivity() const noexcept { return m_connectivity; }
+
+    bool free(Cell const& c) const noexcept
+    {
+      return m_bounds.contains(c) && m_free[static_cast<size_t>(m_bounds.index(c))];
+    }
+
+    std::optional<Cell> straight(Cell const& c, Cell const& d, Cell const& goal) const
+    {
+      auto v {entry(c, d)};
+      auto reach {(v > 0)? v : -v};
+
+      // The goal on the ray is met before anything else
+      auto m {steps(c, d, goal)};
+      if( m > 0 && m <= reach ) return goal;
+
+      // Four-connected rays along the second coordinate also stop on the
+      // goal row when the goal is reached sideways from there
+      if( m_connectivity == Connectivity::four && d.second != 0 && goal.first != c.first )
+      {
+        auto k {(goal.second - c.second) * d.second};
+        if( k > 0 && k <= reach && (v <= 0 || k < v) )
+        {
+          Cell q {c.first, goal.second};
+          Cell side {sign(goal.first - c.first), 0};
+          auto w {entry(q, side)};
+          auto sm {steps(q, side, goal)};
+          if( w <= 0 && sm <= -w ) return q;
+        } // if
+      } // if
+
+      if( v > 0 ) return Cell{c.first + v*d.first, c.second + v*d.second};
+      return std::nullopt;
+    }
+
+  private:
+    static constexpr std::array<Cell,4> s_directions {{ {1,0}, {-1,0}, {0,1}, {0,-1} }};
+
+    static size_t direction(Cell const& d) noexcept
+    {
+      return (d.first == 1)? 0 : (d.first == -1)? 1 : (d.second == 1)? 2 : 3;
+    }
+
+    int64_t entry(Cell const& c, Cell const& d) const noexcept
+    {
+      return m_jump[static_cast<size_t>(m_bounds.index(c))][direction(d)];
+    }
+
+    // Steps from c to goal along d, 0 when goal is not ahead on the ray
+    static int64_t steps(Cell const& c, Cell const& d, Cell const& goal) noexcept
+    {
+      if( d.first != 0 && goal.second == c.second ) { return std::max<int64_t>(0, (goal.first - c.first) * d.first); }
+      if( d.second != 0 && goal.first == c.first ) { return std::max<int64_t>(0, (goal.second - c.second) * d.second); }
+      return 0;
+    }
+
+    // Goal independent jump point test, the sideways rays of four-connected
+    // grids are read from the distances computed first
+    bool jump_point(Cell const& n, Cell const& d) const
+    {
+      if( forced(*this, n, d) ) return true;
+      return m_connectivity == Connectivity::four && d.second != 0
+        && (entry(n, {1,0}) > 0 || entry(n, {-1,0}) > 0);
+    }
+
+    a_star::Bounds m_bounds;
+    Connectivity m_connectivity;
+    std::vector<bool> m_free;
+    std::vector<std::array<int32_t,4>> m_jump;
+}; // class: Plus
+
+//
+// Algorithm
+//
+
+// Jump from c along d: straight directions through the grid, diagonal ones
+// step by step, stopping on cells from which a straight jump succeeds
+template<typename G>
+std::optional<Cell> jump(G const& grid, Cell c, Cell const& d, Cell const& goal)
+{
+  if( d.first == 0 || d.second == 0 ) return grid.straight(c, d, goal);
+
+  while( true )
+  {
+    if( ! grid.free({c.first+d.first,c.second}) || ! grid.free({c.first,c.second+d.second}) ) return std::nullopt;
+    c = c + d;
+    if( ! grid.free(c) ) return std::nullopt;
+    if( c == goal ) return c;
+    if( grid.straight(c, {d.first,0}, goal) || grid.straight(c, {0,d.second}, goal) ) return c;
+  } // while
+}
+
+// Directions worth exploring from c when entered along d, (0,0) for the
+// start cell
+template<typename G>
+std::vector<Cell> directions(G const& grid, Cell const& c, Cell const& d)
+{
+  std::vector<Cell> result;
+  auto add = [&](Cell const& dd, bool ok){ if( ok ) { result.push_back(dd); } };
+  auto free = [&](int64_t dx, int64_t dy){ return grid.free({c.first+dx,c.second+dy}); };
+  auto const eight {grid.connectivity() == Connectivity::eight};
+
+  if( d == Cell{0,0} )
+  {
+    for (auto const& dd : std::array<Cell,4>{{ {1,0}, {-1,0}, {0,1}, {0,-1} }}) { add(dd, free(dd.first,dd.second)); }
+    if( eight )
+    {
+      for (auto const& dd : std::array<Cell,4>{{ {1,1}, {1,-1}, {-1,1}, {-1,-1} }})
+      {
+        add(dd, free(dd.first,0) && free(0,dd.second));
+      } // for: dd
+    } // if
+    return result;
+  } // if
+
+  auto [dx,dy] {d};
+  if( dx != 0 && dy != 0 )
+  {
+    add({0,dy}, free(0,dy));
+    add({dx,0}, free(dx,0));
+    add({dx,dy}, free(0,dy) && free(dx,0));
+  }
+  else if( dx != 0 )
+  {
+    // Forced neighbors only: a free side cell with a blocked cell behind
+    // it, along with the diagonal towards it
+    add({dx,0}, free(dx,0));
+    for (int64_t s : {1,-1})
+    {
+      if( ! free(0,s) || free(-dx,s) ) continue;
+      add({0,s}, true);
+      if( eight ) { add({dx,s}, free(dx,0)); }
+    } // for: s
+  }
+  else
+  {
+    add({0,dy}, free(0,dy));
+    for (int64_t s : {1,-1})
+    {
+      // Four-connected columns branch sideways at every jump point
+      if( ! free(s,0) || (eight && free(s,-dy)) ) continue;
+      add({s,0}, true);
+      if( eight ) { add({s,dy}, free(0,dy)); }
+    } // for: s
+  } // if
+
+  return result;
+}
+
+// Jump point search over the cells of grid, only jump points enter the open
+// set. Returns every cell from start to end like a_star::a_star, empty if end
+// is not reachable.
+template<typename G, typename B>
+std::deque<Cell> search(G const& grid, Cell const& start, Cell const& end, a_star::SearchContext<B>& ctx)
+{
+  auto const& bounds {grid.bounds()};
+  if( ! grid.free(start) || ! grid.free(end) ) return {};
+
+  auto connectivity {grid.connectivity()};
+  auto heuristic = [&](Cell const& c){ return segment(c, end, connectivity); };
+
+  ctx.reset(bounds);
+  auto s {bounds.index(start)};
+  auto e {bounds.index(end)};
+  ctx.relax(s, 0., -1);
+  ctx.open().push(s, heuristic(start));
+
+  while( ! ctx.open().empty() )
+  {
+    auto i {ctx.open().pop()};
+    auto c {bounds.cell(i)};
+
+    // Fill in the cells between consecutive jump points
+    if( i == e )
+    {
+      std::deque<Cell> path{c};
+      for (auto p {ctx.parent(i)}; p != -1; p = ctx.parent(p))
+      {
+        auto q {bounds.cell(p)};
+        Cell d {sign(q.first - path.front().first), sign(q.second - path.front().second)};
+        while( path.front() != q ) { path.push_front(path.front() + d); }
+      } // for: p
+      return path;
+    } // if
+
+    ctx.close(i);
+    auto g {ctx.g_score(i)};
+
+    Cell d {0,0};
+    if( auto p {ctx.parent(i)}; p != -1 )
+    {
+      auto q {bounds.cell(p)};
+      d = {sign(c.first - q.first), sign(c.second - q.second)};
+    } // if
+
+    for (auto const& dd : directions(grid, c, d))
+    {
+      auto n {jump(grid, c, dd, end)};
+      if( ! n ) continue;
+
+      auto j {bounds.index(*n)};
+      if( ctx.closed(j) ) continue;
+
+      auto ng {g + segment(c, *n, connectivity)};
+      if( ng < ctx.g_score(j) )
+      {
+        ctx.relax(j, ng, i);
+        ctx.open().push(j, ng + heuristic(*n));
+      } // if
+    } // for: dd
+  } // while
+
+  return {};
+}
+
+// Jump point search on the uniform-cost grid of the free cells inside
+// bounds, straight moves cost 1 and diagonal moves sqrt(2)
+template<typename T1, typename T2, typename F, typename B>
+std::deque<Cell> jps(a_star::Bounds const& bounds, T1&& start, T2&& end, F&& f_blocked,
+  Connectivity connectivity, a_star::SearchContext<B>& ctx)
+{
+  Walk<std::remove_reference_t<F>> grid{bounds, f_blocked, connectivity};
+  return search(grid, Cell{start.first,start.second}, Cell{end.first,end.second}, ctx);
+}
+
+template<typename T1, typename T2, typename F>
+std::deque<Cell> jps(a_star::Bounds const& bounds, T1&& start, T2&& end, F&& f_blocked,
+  Connectivity connectivity = Connectivity::eight)
+{
+  a_star::SearchContext<> ctx;
+  return jps(bounds, std::forward<T1>(start), std::forward<T2>(end), f_blocked, connectivity, ctx);
+}
+
+// Same search with the straight jumps read from the JPS+ distances
+template<typename T1, typename T2, typename B>
+std::deque<Cell> jps(Plus const& plus, T1&& start, T2&& end, a_star::SearchContext<B>& ctx)
+{
+  return search(plus, Cell{start.first,start.second}, Cell{end.first,end.second}, ctx);
+}
+
+template<typename T1, typename T2>
+std::deque<Cell> jps(Plus const& plus, T1&& start, T2&& end)
+{
+  a_star::SearchContext<> ctx;
+  return jps(plus, std::forward<T1>(start), std::forward<T2>(end), ctx);
+}
+
+} // namespace celaeno::graph::jps
@@ -33,9 +33,14 @@
 
 #include <vector>
 #include <deque>
+#include <queue>
 #include <unordered_map>
+#include <functional>
+#include <concepts>
+#include <ranges>
+#include <optional>
 #include <celaeno/graph/bfs.hpp>
-#include <fplus/fplus.hpp>
+#include <celaeno/graph/traversal.hpp>
 
 namespace celaeno::graph::kahn
 {
@@ -43,15 +48,13 @@ namespace celaeno::graph::kahn
 //
 // Aliases
 //
-namespace fp = fplus;
-namespace fw = fplus::fwd;
-namespace bfs = celaeno::graph::bfs;
+namespace traversal = celaeno::graph::traversal;
 
 //
 // Concepts
 //
 template<typename T>
-concept Iterable = requires{ std::input_iterator<T> && std::incrementable<T>; };
+concept Iterable = std::ranges::input_range<T>;
 
 template<typename T>
 concept SignedIntegral = std::signed_integral<T>;
@@ -62,27 +65,56 @@ concept Fn = requires(T t){ {t(int64_t{})} -> Iterable; };
 template<typename T>
 concept Fc = requires(T t){ {t(int64_t{})} -> std::same_as<bool>; };
 
+//
+// Helpers
+//
+
+// Breadth-first discovery through predecessors and successors, counting the
+// in-degree of each vertex once. Vertices without predecessors are appended
+// to sources. The in-degree map doubles as the visited set.
+template<SignedIntegral T, Fn F1, Fn F2>
+void count_in_degree(T root,
+  F1& pred,
+  F2& succ,
+  std::unordered_map<T,int64_t>& in_degree,
+  std::deque<T>& sources)
+{
+  std::queue<T> queue;
+  auto discover = [&in_degree,&queue](auto&& v)
+  {
+    if( ! in_degree.contains(v) ) { in_degree.emplace(v,0); queue.push(v); }
+  };
+
+  discover(root);
+  while (! queue.empty() )
+  {
+    auto v{queue.front()}; queue.pop();
+    int64_t degree{0};
+    for( auto p : pred(v) ) { ++degree; discover(p); }
+    for( auto s : succ(v) ) { discover(s); }
+    in_degree.at(v) = degree;
+    if( degree == 0 ) { sources.push_back(v); }
+  } // while: ! queue.empty()
+} // function: count_in_degree
+
 //
 // Algorithm
 //
 template< SignedIntegral T, Fn F1, Fn F2, Fc F3 = std::function<bool(int64_t)> >
 std::vector<T> kahn(T&& root, F1&& pred, F2&& succ, F3&& cb = [](auto&&){return false;})
 {
-  auto adj = [&pred,&succ](auto&& v){ return fp::append(pred(v),succ(v)); };
-
   // Topologically sorted result
   std::vector<T> result;
 
   // Vertices with no incomming edges
   std::deque<T> deque;
 
-  // Removed edges
-  std::set<std::pair<T,T>> re;
+  // Number of incoming edges not yet removed from each vertex
+  std::unordered_map<T,int64_t> in_degree;
 
-  // Populate the deque
-  auto has_pred = [&pred](auto&& v){ return ! pred(v).empty(); };
-  bfs::bfs(root,adj,[&has_pred,&deque](auto&& v)
-    { if( ! has_pred(v) ){ deque.push_back(v); } return false; });
+  // Count the in-degree of each vertex once
+  // Populate the deque with the ones without predecessors
+  count_in_degree<std::decay_t<T>>(root,pred,succ,in_degree,deque);
 
   while (! deque.empty() )
   {
@@ -98,16 +130,57 @@ std::vector<T> kahn(T&& root, F1&& pred, F2&& succ, F3&& cb = [](auto&&){return
     // Get successors
     for( auto s : succ(c) )
     {
-      // remove edge c -> s
-      re.insert({c,s});
-      // If s has no more predecessors
-      auto is_rm = [&s,&re](auto&& v){ return re.contains({v,s}); };
-      auto preds_s {fp::drop_if(is_rm, pred(s))};
-      // Insert s into the queue
-      if( preds_s.empty() ) { deque.push_back(s); }
+      // Remove edge c -> s
+      // If s has no more predecessors, insert it into the queue
+      if( --in_degree.at(s) == 0 ) { deque.push_back(s); }
     }
   } // while: ! initial.empty()
   return result;
 }
 
+//
+// Lazy algorithm
+//
+// Yields the vertices in the same order as kahn. The in-degrees are counted
+// when the view is created, the successors of a vertex are only released once
+// the view moves past it.
+//
+template<SignedIntegral T, Fn F1, Fn F2>
+struct Step
+{
+  F1 pred;
+  F2 succ;
+  std::unordered_map<T,int64_t> in_degree{};
+  std::deque<T> deque{};
+  std::optional<T> last{};
+
+  // Remove the edges leaving the last vertex and move to the next one
+  std::optional<T> operator()()
+  {
+    if( last )
+    {
+      for( auto s : succ(*last) )
+      {
+        if( --in_degree.at(s) == 0 ) { deque.push_back(s); }
+      }
+      last.reset();
+    } // if
+
+    if( ! deque.empty() ) { last = deque.front(); deque.pop_front(); }
+    return last;
+  }
+}; // struct: Step
+
+template<SignedIntegral T, Fn F1, Fn F2>
+using Lazy = traversal::Lazy<T,Step<T,F1,F2>>;
+
+// Lvalue callables are referenced, not copied
+template<SignedIntegral T, Fn F1, Fn F2>
+Lazy<T,F1,F2> lazy(T root, F1&& pred, F2&& succ)
+{
+  Step<T,F1,F2> step{std::forward<F1>(pred), std::forward<F2>(succ)};
+  count_in_degree(root, step.pred, step.succ, step.in_degree, step.deque);
+  return Lazy<T,F1,F2>{std::move(step)};
+}
+
 } // namespace celaeno::graph::kahn
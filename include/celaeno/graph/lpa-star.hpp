@@ -0,0 +1,243 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : lpa-star
+// @created     : Saturday Oct 17, 2026 03:49:13 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <celaeno/graph/a-star.hpp>
+
+namespace celaeno::graph::lpa_star
+{
+//
+// Aliases
+//
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+using Cell = std::pair<int64_t,int64_t>;
+
+//
+// Lifelong Planning A*
+//
+// Shortest path between two fixed cells of a bounded grid (a_star::Bounds or
+// a math::tiled::Layout) that is kept between queries. f_distance(n) is the
+// cost of entering n, infinite for blocked cells, f_neighbors must be
+// symmetric and f_heuristic(n) a consistent estimate of the cost from n to
+// the goal. When the cost of a cell changes, report it through update; the
+// next path() only revisits the cells whose distance from the start is
+// affected.
+//
+template<a_star::Grid G, typename F1, typename F2, typename F3>
+class Planner
+{
+  public:
+    using Key = std::pair<float64_t,float64_t>;
+
+    Planner(G const& bounds, Cell start, Cell goal, F1 f_neighbors, F2 f_distance, F3 f_heuristic)
+      : m_bounds{bounds}
+      , m_start{start}
+      , m_goal{goal}
+      , m_neighbors{std::move(f_neighbors)}
+      , m_distance{std::move(f_distance)}
+      , m_heuristic{std::move(f_heuristic)}
+      , m_g(bounds.size(), s_inf)
+      , m_rhs(bounds.size(), s_inf)
+      , m_open{bounds.size()}
+      , m_next(bounds.size(), -1)
+    {
+      if( ! m_bounds.contains(m_start) || ! m_bounds.contains(m_goal) ) return;
+      auto s {m_bounds.index(m_start)};
+      m_rhs[static_cast<size_t>(s)] = 0.;
+      m_open.push(s, key(s));
+    }
+
+    // Cost of the path from start to goal, infinite when there is none
+    float64_t cost()
+    {
+      compute();
+      return m_bounds.contains(m_goal)? m_g[static_cast<size_t>(m_bounds.index(m_goal))] : s_inf;
+    }
+
+    // Cells from start to goal, empty when the goal is not reachable
+    std::deque<Cell> path()
+    {
+      if( cost() == s_inf ) return {};
+
+      // Breadth-first walk back from the goal through the neighbors that
+      // realize its distance, zero-cost plateaus keep the same g and are
+      // settled by the fewest steps
+      auto s {m_bounds.index(m_start)};
+      auto goal {m_bounds.index(m_goal)};
+      std::vector<int64_t> touched{goal};
+      m_next[static_cast<size_t>(goal)] = goal;
+      for (size_t k{0}; k < touched.size() && m_next[static_cast<size_t>(s)] < 0; ++k)
+      {
+        auto v {touched[k]};
+        auto g {m_g[static_cast<size_t>(v)]};
+        auto c {static_cast<float64_t>(m_distance(m_bounds.cell(v)))};
+        for (auto&& n : m_neighbors(m_bounds.cell(v)))
+        {
+          if( ! m_bounds.contains(n) ) continue;
+          auto const j {static_cast<size_t>(m_bounds.index(n))};
+          if( m_next[j] >= 0 || m_g[j] + c != g ) continue;
+          m_next[j] = v;
+          touched.push_back(static_cast<int64_t>(j));
+        } // for: n
+      } // for: k
+
+      // Follow the links from the start, none when no predecessor exists
+      std::deque<Cell> result;
+      if( m_next[static_cast<size_t>(s)] >= 0 )
+      {
+        for (auto v {s}; v != goal; v = m_next[static_cast<size_t>(v)]) { result.push_back(m_bounds.cell(v)); }
+        result.push_back(m_goal);
+      } // if
+
+      for (auto const& v : touched) { m_next[static_cast<size_t>(v)] = -1; }
+      return result;
+    }
+
+    // The cost of entering c, or its neighbors, changed
+    template<typename P>
+    void update(P const& c)
+    {
+      Cell cell {c.first, c.second};
+      if( ! m_bounds.contains(cell) ) return;
+      vertex(m_bounds.index(cell));
+      for (auto&& n : m_neighbors(cell))
+      {
+        if( m_bounds.contains(n) ) { vertex(m_bounds.index(n)); }
+      } // for: n
+    }
+
+    // Cells expanded since construction
+    size_t expansions() const noexcept { return m_expansions; }
+
+  private:
+    static constexpr float64_t s_inf {std::numeric_limits<float64_t>::infinity()};
+
+    Key key(int64_t i) const
+    {
+      auto m {std::min(m_g[static_cast<size_t>(i)], m_rhs[static_cast<size_t>(i)])};
+      return {m + m_heuristic(m_bounds.cell(i)), m};
+    }
+
+    // Recompute the one-step lookahead of i and queue it if inconsistent
+    void vertex(int64_t i)
+    {
+      auto cell {m_bounds.cell(i)};
+      if( cell != m_start )
+      {
+        auto rhs {s_inf};
+        auto c {static_cast<float64_t>(m_distance(cell))};
+        if( c != s_inf )
+        {
+          for (auto&& n : m_neighbors(cell))
+          {
+            if( ! m_bounds.contains(n) ) continue;
+            rhs = std::min(rhs, m_g[static_cast<size_t>(m_bounds.index(n))] + c);
+          } // for: n
+        } // if
+        m_rhs[static_cast<size_t>(i)] = rhs;
+      } // if
+
+      if( m_g[static_cast<size_t>(i)] != m_rhs[static_cast<size_t>(i)] ) { m_open.update(i, key(i)); }
+      else { m_open.erase(i); }
+    }
+
+    void successors(int64_t i)
+    {
+      for (auto&& n : m_neighbors(m_bounds.cell(i)))
+      {
+        if( m_bounds.contains(n) ) { vertex(m_bounds.index(n)); }
+      } // for: n
+    }
+
+    void compute()
+    {
+      if( ! m_bounds.contains(m_goal) ) return;
+      auto goal {m_bounds.index(m_goal)};
+      auto const g {static_cast<size_t>(goal)};
+
+      while( ! m_open.empty() && (m_open.top() < key(goal) || m_rhs[g] != m_g[g]) )
+      {
+        auto i {m_open.pop()};
+        auto const u {static_cast<size_t>(i)};
+        ++m_expansions;
+
+        if( m_g[u] > m_rhs[u] )
+        {
+          // Overconsistent, the distance settles
+          m_g[u] = m_rhs[u];
+          successors(i);
+        }
+        else
+        {
+          // Underconsistent, the distance is raised and recomputed
+          m_g[u] = s_inf;
+          vertex(i);
+          successors(i);
+        } // if
+      } // while
+    }
+
+    G m_bounds;
+    Cell m_start;
+    Cell m_goal;
+    F1 m_neighbors;
+    F2 m_distance;
+    F3 m_heuristic;
+    std::vector<float64_t> m_g;
+    std::vector<float64_t> m_rhs;
+    a_star::Heap<Key> m_open;
+    // Next cell towards the goal during path(), -1 elsewhere
+    std::vector<int64_t> m_next;
+    size_t m_expansions{0};
+}; // class: Planner
+
+//
+// Algorithm
+//
+
+template<a_star::Grid G, typename T1, typename T2, typename F1, typename F2, typename F3>
+auto planner(G const& bounds, T1&& start, T2&& end, F1&& f_neighbors, F2&& f_distance, F3&& f_heuristic)
+{
+  return Planner<G,std::decay_t<F1>,std::decay_t<F2>,std::decay_t<F3>>{
+    bounds, Cell{start.first,start.second}, Cell{end.first,end.second},
+    std::forward<F1>(f_neighbors), std::forward<F2>(f_distance), std::forward<F3>(f_heuristic)};
+} // planner
+
+} // namespace celaeno::graph::lpa_star
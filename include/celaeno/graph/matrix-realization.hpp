@@ -36,8 +36,12 @@
 #include <range/v3/all.hpp>
 #include <fplus/fplus.hpp>
 #include <vector>
+#include <span>
+#include <ranges>
 #include <concepts>
 #include <iterator>
+#include <algorithm>
+#include <unordered_map>
 
 namespace celaeno::graph::matrix_realization
 {
@@ -75,6 +79,13 @@ concept Layer =
     { t(int64_t{}).size() } -> std::integral;
   };
 
+template<typename T>
+concept Function =
+  requires(T t)
+  {
+    { t(int64_t{}) } -> std::ranges::input_range;
+  };
+
 template<typename T>
 concept HasEdge =
   requires(T t)
@@ -82,6 +93,67 @@ concept HasEdge =
     { t(int64_t{},int64_t{}) } -> std::same_as<bool>;
   };
 
+//
+// Sparse incidence matrix
+//
+// Rows are the vertices of layer i and columns the vertices of layer i+1,
+// both by position in their layer. Only the nonzero cells are stored, as the
+// sorted column indices of each row (compressed sparse rows).
+//
+class Sparse
+{
+  public:
+    Sparse() = default;
+
+    Sparse(size_t cols, std::vector<size_t> offsets, std::vector<int32_t> columns)
+      : m_cols{cols}
+      , m_offsets{std::move(offsets)}
+      , m_columns{std::move(columns)}
+    {}
+
+    // Number of rows and columns
+    size_t rows() const noexcept { return m_offsets.empty()? 0 : m_offsets.size()-1; }
+    size_t cols() const noexcept { return m_cols; }
+
+    // Number of nonzero cells
+    size_t nonzeros() const noexcept { return m_columns.size(); }
+
+    // Columns of the nonzero cells of row r, in increasing order
+    std::span<int32_t const> row(size_t r) const noexcept
+    {
+      return {m_columns.data()+m_offsets[r], m_offsets[r+1]-m_offsets[r]};
+    }
+
+    // Cell (r,c) as in the dense matrix
+    int32_t at(size_t r, size_t c) const noexcept
+    {
+      auto cells {row(r)};
+      return std::ranges::binary_search(cells, static_cast<int32_t>(c))? 1 : 0;
+    }
+
+    // Layer i+1 in the rows and layer i in the columns
+    Sparse transpose() const
+    {
+      std::vector<size_t> offsets(m_cols+1, 0);
+      for (auto const& c : m_columns) { ++offsets[static_cast<size_t>(c)+1]; }
+      for (size_t i{1}; i < offsets.size(); ++i) { offsets[i] += offsets[i-1]; }
+
+      std::vector<int32_t> columns(m_columns.size());
+      std::vector<size_t> fill(offsets.begin(), offsets.end()-1);
+      for (size_t r{0}; r < rows(); ++r)
+      {
+        for (auto const& c : row(r)) { columns[fill[static_cast<size_t>(c)]++] = static_cast<int32_t>(r); }
+      } // for: r
+
+      return Sparse{rows(), std::move(offsets), std::move(columns)};
+    }
+
+  private:
+    size_t m_cols{0};
+    std::vector<size_t> m_offsets{};
+    std::vector<int32_t> m_columns{};
+}; // class: Sparse
+
 //
 // Algorithm
 //
@@ -127,4 +199,44 @@ auto matrix_realization(L&& get_layer, E&& has_edge, uint64_t height)
   return result;
 }
 
+// Same matrices as matrix_realization, built by walking the successors of
+// each vertex of layer i against a position lookup of layer i+1, O(E) edge
+// tests instead of |l1|·|l2|
+template<Layer L, Function F>
+auto sparse(L&& get_layer, F&& succ, uint64_t height)
+{
+  std::vector<Sparse> result;
+  if( height == 0 ) { return result; }
+
+  auto l1 {get_layer(0)};
+  for (uint64_t i{0}; i < height-1; ++i)
+  {
+    auto l2 {get_layer(i+1)};
+
+    // Position of each vertex of layer i+1
+    std::unordered_map<std::decay_t<decltype(*l2.begin())>,int32_t> position;
+    int32_t index{0};
+    for (auto&& u : l2) { position.emplace(u, index++); }
+
+    std::vector<size_t> offsets{0};
+    std::vector<int32_t> columns;
+    for (auto&& v : l1)
+    {
+      auto first {columns.size()};
+      for (auto&& u : succ(v))
+      {
+        if( auto it {position.find(u)}; it != position.end() ) { columns.push_back(it->second); }
+      } // for: u
+      std::sort(columns.begin()+static_cast<std::ptrdiff_t>(first), columns.end());
+      columns.erase(std::unique(columns.begin()+static_cast<std::ptrdiff_t>(first), columns.end()), columns.end());
+      offsets.push_back(columns.size());
+    } // for: v
+
+    result.emplace_back(static_cast<size_t>(index), std::move(offsets), std::move(columns));
+    l1 = std::move(l2);
+  } // for: i
+
+  return result;
+} // function: sparse
+
 } // namespace celaeno::graph::matrix_realization
@@ -0,0 +1,262 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : minimize-crossings
+// @created     : Saturday Oct 17, 2026 03:30:45 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+#include <ranges>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <celaeno/graph/barycenter.hpp>
+#include <celaeno/graph/crossings.hpp>
+
+namespace celaeno::graph::minimize_crossings
+{
+//
+// Aliases
+//
+namespace barycenter = celaeno::graph::barycenter;
+namespace crossings = celaeno::graph::crossings;
+
+//
+// Concepts
+//
+
+// Incidence matrices between consecutive layers, as produced by
+// matrix_realization or matrix_realization::sparse: matrix i has layer i in
+// the rows and layer i+1 in the columns
+template<typename Ms>
+concept Matrices =
+  std::ranges::random_access_range<Ms>
+&&
+  (crossings::DenseMatrix<std::ranges::range_value_t<Ms>>
+    || crossings::SparseMatrix<std::ranges::range_value_t<Ms>>);
+
+//
+// Helpers
+//
+
+// Nonzero entries of the incidence matrices, indexed by vertex, read once
+// so the sweeps never go back to the dense matrices
+class Incidence
+{
+  public:
+    using Edge = std::pair<int64_t,int64_t>;
+
+    template<Matrices Ms>
+    explicit Incidence(Ms const& matrices)
+    {
+      using M = std::ranges::range_value_t<Ms>;
+      if constexpr ( crossings::SparseMatrix<M> )
+      {
+        m_sizes.push_back(matrices.empty()? 0 : static_cast<int64_t>(matrices[0].rows()));
+      }
+      else
+      {
+        m_sizes.push_back(matrices.empty()? 0 : static_cast<int64_t>(std::ranges::size(matrices[0])));
+      } // if
+
+      for (auto const& m : matrices)
+      {
+        std::vector<std::vector<Edge>> down, up;
+        auto add = [&down,&up](int64_t r, int64_t c, int64_t w)
+        {
+          if( down.size() <= static_cast<size_t>(c) ) { down.resize(static_cast<size_t>(c)+1); }
+          up[static_cast<size_t>(r)].emplace_back(c, w);
+          down[static_cast<size_t>(c)].emplace_back(r, w);
+        };
+
+        if constexpr ( crossings::SparseMatrix<M> )
+        {
+          up.resize(m.rows());
+          down.resize(m.cols());
+          for (size_t r{0}; r < m.rows(); ++r)
+          {
+            for (auto const& c : m.row(r)) { add(static_cast<int64_t>(r), static_cast<int64_t>(c), 1); }
+          } // for: r
+        }
+        else
+        {
+          for (auto const& row : m)
+          {
+            int64_t c{0};
+            up.emplace_back();
+            for (auto const& w : row)
+            {
+              if( down.size() <= static_cast<size_t>(c) ) { down.resize(static_cast<size_t>(c)+1); }
+              if( w != 0 ) { add(static_cast<int64_t>(up.size())-1, c, static_cast<int64_t>(w)); }
+              ++c;
+            } // for: w
+          } // for: row
+        } // if
+
+        m_sizes.push_back(static_cast<int64_t>(down.size()));
+        m_down.push_back(std::move(down));
+        m_up.push_back(std::move(up));
+      } // for: m
+    }
+
+    // Number of layers
+    size_t height() const noexcept { return m_sizes.size(); }
+
+    // Number of vertices on layer l
+    int64_t size(size_t l) const noexcept { return m_sizes[l]; }
+
+    // Neighbors of vertex v of layer l on layer l-1, as (vertex, weight)
+    std::vector<Edge> const& up(size_t l, int64_t v) const { return m_down[l-1][static_cast<size_t>(v)]; }
+
+    // Neighbors of vertex v of layer l on layer l+1, as (vertex, weight)
+    std::vector<Edge> const& down(size_t l, int64_t v) const { return m_up[l][static_cast<size_t>(v)]; }
+
+  private:
+    std::vector<int64_t> m_sizes{};
+    std::vector<std::vector<std::vector<Edge>>> m_down{};
+    std::vector<std::vector<std::vector<Edge>>> m_up{};
+}; // class: Incidence
+
+// Crossings between layers l and l+1 under the given orders
+inline int64_t count(Incidence const& inc, std::vector<std::vector<int64_t>> const& position, size_t l)
+{
+  std::vector<std::tuple<int64_t,int64_t,int64_t>> edges;
+  for (int64_t v{0}; v < inc.size(l); ++v)
+  {
+    for (auto const& [u,w] : inc.down(l,v))
+    {
+      edges.emplace_back(position[l][static_cast<size_t>(v)], position[l+1][static_cast<size_t>(u)], w);
+    } // for: u
+  } // for: v
+  return crossings::count(edges, inc.size(l), inc.size(l+1));
+} // function: count
+
+inline int64_t count(Incidence const& inc, std::vector<std::vector<int64_t>> const& position)
+{
+  int64_t total{0};
+  for (size_t l{0}; l+1 < inc.height(); ++l) { total += count(inc, position, l); }
+  return total;
+} // function: count
+
+// Reorder layer l by the barycenter of its neighbors on layer fixed,
+// vertices without neighbors there keep their current position
+inline void reorder(Incidence const& inc
+  , std::vector<std::vector<int64_t>>& order
+  , std::vector<std::vector<int64_t>>& position
+  , size_t l
+  , size_t fixed)
+{
+  auto& layer {order[l]};
+  std::vector<double> key(layer.size());
+  std::vector<std::pair<int64_t,int64_t>> neighbors;
+  for (auto const& v : layer)
+  {
+    auto const& adj {(fixed < l)? inc.up(l,v) : inc.down(l,v)};
+    neighbors.clear();
+    for (auto const& [u,w] : adj) { neighbors.emplace_back(position[fixed][static_cast<size_t>(u)], w); }
+    key[static_cast<size_t>(v)] = neighbors.empty()?
+      static_cast<double>(position[l][static_cast<size_t>(v)]+1) : barycenter::sparse(neighbors);
+  } // for: v
+
+  std::ranges::stable_sort(layer, {}, [&key](int64_t v){ return key[static_cast<size_t>(v)]; });
+  for (size_t i{0}; i < layer.size(); ++i) { position[l][static_cast<size_t>(layer[i])] = static_cast<int64_t>(i); }
+} // function: reorder
+
+//
+// Algorithm
+//
+
+// Layer-sweep crossing minimization over the permutation arrays in order:
+// order[l][k] is the row/column index (in the matrices) of the vertex at
+// position k of layer l. Each iteration sweeps down reordering each layer by
+// the barycenter of its upper neighbors, then up by its lower neighbors. The
+// best orders seen are kept in order; stops when an iteration leaves the
+// orders unchanged, when no crossings remain or after iterations. Returns
+// the number of crossings of the final orders.
+template<Matrices Ms>
+int64_t run(Ms const& matrices, std::vector<std::vector<int64_t>>& order, size_t iterations = 24)
+{
+  Incidence inc{matrices};
+
+  // Identity orders for the layers not given
+  order.resize(inc.height());
+  for (size_t l{0}; l < inc.height(); ++l)
+  {
+    if( order[l].size() != static_cast<size_t>(inc.size(l)) )
+    {
+      order[l].resize(static_cast<size_t>(inc.size(l)));
+      std::iota(order[l].begin(), order[l].end(), int64_t{0});
+    } // if
+  } // for: l
+
+  std::vector<std::vector<int64_t>> position(inc.height());
+  for (size_t l{0}; l < inc.height(); ++l)
+  {
+    position[l].resize(order[l].size());
+    for (size_t i{0}; i < order[l].size(); ++i) { position[l][static_cast<size_t>(order[l][i])] = static_cast<int64_t>(i); }
+  } // for: l
+
+  auto best {order};
+  auto best_crossings {count(inc, position)};
+
+  for (size_t it{0}; it < iterations && best_crossings > 0; ++it)
+  {
+    auto previous {order};
+
+    // Down sweep
+    for (size_t l{1}; l < inc.height(); ++l) { reorder(inc, order, position, l, l-1); }
+    // Up sweep
+    for (size_t l{inc.height()-1}; l-- > 0;) { reorder(inc, order, position, l, l+1); }
+
+    auto current {count(inc, position)};
+    if( current < best_crossings )
+    {
+      best_crossings = current;
+      best = order;
+    } // if
+
+    if( order == previous ) { break; }
+  } // for: it
+
+  order = std::move(best);
+  return best_crossings;
+} // function: run
+
+// Layer-sweep crossing minimization starting from the identity orders,
+// returns the orders and their number of crossings
+template<Matrices Ms>
+std::pair<std::vector<std::vector<int64_t>>,int64_t> run(Ms const& matrices, size_t iterations = 24)
+{
+  std::vector<std::vector<int64_t>> order;
+  auto c {run(matrices, order, iterations)};
+  return std::make_pair(std::move(order), c);
+} // function: run
+
+} // namespace celaeno::graph::minimize_crossings
@@ -0,0 +1,168 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : ms-bfs
+// @created     : Saturday Oct 17, 2026 03:20:58 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <vector>
+#include <array>
+#include <bit>
+#include <ranges>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+
+namespace celaeno::graph::ms_bfs
+{
+
+//
+// Concepts
+//
+template<typename T>
+concept Iterable = std::ranges::input_range<T>;
+
+template<typename T>
+concept Fn = requires(T t){ {t(int64_t{})} -> Iterable; };
+
+template<typename T>
+concept Sources = Iterable<T> && std::signed_integral<std::ranges::range_value_t<T>>;
+
+//
+// Algorithm
+//
+// Multi-source breadth-first search over the vertex ids [0,n), as in MS-BFS.
+// Each vertex keeps a bitmask of W 64-bit words with one bit per source, so
+// a single pass over the graph advances up to 64*W searches at once; more
+// sources are processed in batches of that size. W = 4 gives 256 sources per
+// pass with masks that the compiler can keep in vector registers.
+//
+// Calls cb(source index, vertex, level) once for every vertex reached by
+// every source, sources included at level zero. Levels are non-decreasing
+// per source.
+//
+template<size_t W = 1, Sources S, Fn F, typename Fv>
+void ms_bfs(S const& sources, size_t n, F&& adj, Fv&& cb)
+{
+  using T = std::ranges::range_value_t<S>;
+  using Mask = std::array<uint64_t,W>;
+
+  std::vector<T> roots(std::ranges::begin(sources), std::ranges::end(sources));
+
+  // Sources that have reached each vertex
+  std::vector<Mask> seen(n);
+  // Sources that reach each vertex on the current and next levels
+  std::vector<Mask> visit(n), visit_next(n);
+  // Vertices with a non-empty mask on the current and next levels
+  std::vector<T> frontier, frontier_next;
+
+  auto empty = [](Mask const& m)
+  {
+    return std::all_of(m.begin(), m.end(), [](auto w){ return w == 0; });
+  };
+
+  // Report each source in mask m reaching v
+  auto report = [&cb](size_t base, Mask const& m, T v, int64_t level)
+  {
+    for (size_t w{0}; w < W; ++w)
+    {
+      for (auto bits {m[w]}; bits != 0; bits &= bits-1)
+      {
+        cb(base + w*64 + static_cast<size_t>(std::countr_zero(bits)), v, level);
+      } // for: bits
+    } // for: w
+  };
+
+  for (size_t base{0}; base < roots.size(); base += 64*W)
+  {
+    std::fill(seen.begin(), seen.end(), Mask{});
+    frontier.clear();
+
+    // Sources of this batch
+    auto last {std::min(roots.size(), base+64*W)};
+    for (size_t i{base}; i < last; ++i)
+    {
+      auto v {static_cast<size_t>(roots[i])};
+      if( roots[i] < 0 || v >= n ) continue;
+      if( empty(visit[v]) ) { frontier.push_back(roots[i]); }
+      seen[v][(i-base)/64] |= uint64_t{1} << ((i-base)%64);
+      visit[v][(i-base)/64] |= uint64_t{1} << ((i-base)%64);
+    } // for: i
+    for (auto const& v : frontier) { report(base, visit[static_cast<size_t>(v)], v, 0); }
+
+    for (int64_t level{1}; ! frontier.empty(); ++level)
+    {
+      // Propagate the masks of the frontier to the neighbors
+      for (auto const& v : frontier)
+      {
+        auto const& mv {visit[static_cast<size_t>(v)]};
+        for (auto&& u : adj(v))
+        {
+          auto i {static_cast<size_t>(u)};
+          if( u < 0 || i >= n ) continue;
+          Mask d;
+          for (size_t w{0}; w < W; ++w) { d[w] = mv[w] & ~seen[i][w]; }
+          if( empty(d) ) continue;
+          if( empty(visit_next[i]) ) { frontier_next.push_back(static_cast<T>(u)); }
+          for (size_t w{0}; w < W; ++w) { visit_next[i][w] |= d[w]; }
+        } // for: u
+      } // for: v
+
+      // Clear the current level
+      for (auto const& v : frontier) { visit[static_cast<size_t>(v)] = Mask{}; }
+
+      // Mark and report the newly reached vertices
+      for (auto const& v : frontier_next)
+      {
+        auto i {static_cast<size_t>(v)};
+        for (size_t w{0}; w < W; ++w) { seen[i][w] |= visit_next[i][w]; }
+        report(base, visit_next[i], v, level);
+      } // for: v
+
+      std::swap(visit, visit_next);
+      std::swap(frontier, frontier_next);
+      frontier_next.clear();
+    } // for: level
+  } // for: base
+} // function: ms_bfs
+
+// Vertices reached by each source, ordered by level
+template<size_t W = 1, Sources S, Fn F>
+auto ms_bfs(S const& sources, size_t n, F&& adj)
+{
+  using T = std::ranges::range_value_t<S>;
+
+  std::vector<std::vector<T>> result(static_cast<size_t>(std::ranges::distance(sources)));
+  ms_bfs<W>(sources, n, std::forward<F>(adj),
+    [&result](size_t source, T v, int64_t){ result[source].push_back(v); });
+
+  return result;
+} // function: ms_bfs
+
+} // namespace celaeno::graph::ms_bfs
@@ -0,0 +1,218 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : parallel-bfs
+// @created     : Saturday Oct 17, 2026 03:17:32 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <barrier>
+#include <ranges>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+
+namespace celaeno::graph::parallel_bfs
+{
+
+//
+// Concepts
+//
+template<typename T>
+concept Iterable = std::ranges::input_range<T>;
+
+template<typename T>
+concept SignedIntegral = std::signed_integral<T>;
+
+template<typename T>
+concept Fn = requires(T t){ {t(int64_t{})} -> Iterable; };
+
+//
+// Algorithm
+//
+// Level-synchronous breadth-first search over the vertex ids [0,n), expanding
+// each level either top-down (the frontier scans its successors) or bottom-up
+// (unvisited vertices scan their predecessors for a frontier vertex), as in
+// Beamer's direction-optimizing BFS. For a search over an undirected
+// adjacency pass the same callable as succ and pred.
+//
+// Switches to bottom-up once the edges leaving the frontier exceed
+// 1/alpha of the edges left to explore, and back to top-down once the
+// frontier has less than n/beta vertices. Both callables are invoked
+// concurrently and must be safe to call from several threads.
+//
+// Returns the visited vertices ordered by level (the order inside a level is
+// unspecified) and the level of each id, -1 for the unreachable ones.
+//
+template<SignedIntegral T, Fn F1, Fn F2>
+std::pair<std::vector<T>,std::vector<int64_t>> parallel_bfs(
+  T root,
+  size_t n,
+  F1&& succ,
+  F2&& pred,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()),
+  int64_t alpha = 14,
+  int64_t beta = 24)
+{
+  threads = std::max<size_t>(threads, 1);
+
+  // Vertices in visit order, the current frontier is its tail
+  std::vector<T> result;
+  std::vector<int64_t> level(n, -1);
+
+  if( root < 0 || static_cast<size_t>(root) >= n ) return {result, level};
+
+  // Visited vertices, updated concurrently
+  std::vector<std::atomic<uint64_t>> visited((n+63)/64);
+  auto test_and_set = [&visited](auto v)
+  {
+    auto mask {uint64_t{1} << (static_cast<size_t>(v)%64)};
+    return visited[static_cast<size_t>(v)/64].fetch_or(mask, std::memory_order_relaxed) & mask;
+  };
+
+  // Frontier as a bitmap, read-only during bottom-up steps
+  std::vector<uint64_t> in_frontier((n+63)/64, 0);
+
+  // Per-thread discoveries and the out-degree sum of those
+  std::vector<std::vector<T>> buffers(threads);
+  std::vector<int64_t> degrees(threads, 0);
+
+  auto out_degree = [&succ](auto v){ return static_cast<int64_t>(std::ranges::distance(succ(v))); };
+
+  // Edges not yet reached by the search
+  int64_t unexplored{0};
+  for (size_t v{0}; v < n; ++v) { unexplored += out_degree(static_cast<T>(v)); }
+
+  // Search state, only modified by the barrier completion
+  size_t begin{0};
+  int64_t depth{0};
+  int64_t frontier_edges{out_degree(root)};
+  bool bottom_up{false};
+  bool done{false};
+
+  test_and_set(root);
+  level[static_cast<size_t>(root)] = 0;
+  result.push_back(root);
+  unexplored -= frontier_edges;
+
+  // Split [0,size) into one contiguous chunk per thread
+  auto chunk = [threads](size_t t, size_t size)
+  {
+    return std::make_pair(size*t/threads, size*(t+1)/threads);
+  };
+
+  // Merge the discoveries into the next frontier and pick its direction
+  auto next_level = [&]() noexcept
+  {
+    begin = result.size();
+    frontier_edges = 0;
+    for (size_t t{0}; t < threads; ++t)
+    {
+      result.insert(result.end(), buffers[t].begin(), buffers[t].end());
+      buffers[t].clear();
+      frontier_edges += std::exchange(degrees[t], 0);
+    } // for: t
+    unexplored -= frontier_edges;
+    ++depth;
+
+    auto frontier_size {static_cast<int64_t>(result.size()-begin)};
+    done = (frontier_size == 0);
+
+    if( ! bottom_up && frontier_edges > unexplored/alpha ) { bottom_up = true; }
+    else if( bottom_up && frontier_size < static_cast<int64_t>(n)/beta ) { bottom_up = false; }
+
+    if( bottom_up )
+    {
+      std::fill(in_frontier.begin(), in_frontier.end(), 0);
+      for (size_t i{begin}; i < result.size(); ++i)
+      {
+        auto v {static_cast<size_t>(result[i])};
+        in_frontier[v/64] |= uint64_t{1} << (v%64);
+      } // for: i
+    } // if
+  };
+
+  std::barrier sync(static_cast<std::ptrdiff_t>(threads), next_level);
+
+  auto top_down = [&](size_t t)
+  {
+    auto [lo,hi] {chunk(t, result.size()-begin)};
+    for (size_t i{begin+lo}; i < begin+hi; ++i)
+    {
+      for (auto&& v : succ(result[i]))
+      {
+        if( v < 0 || static_cast<size_t>(v) >= n || test_and_set(v) ) continue;
+        level[static_cast<size_t>(v)] = depth+1;
+        buffers[t].push_back(v);
+        degrees[t] += out_degree(v);
+      } // for: v
+    } // for: i
+  };
+
+  auto bottom_up_step = [&](size_t t)
+  {
+    auto [lo,hi] {chunk(t, n)};
+    for (size_t v{lo}; v < hi; ++v)
+    {
+      if( level[v] >= 0 ) continue;
+      for (auto&& u : pred(static_cast<T>(v)))
+      {
+        auto i {static_cast<size_t>(u)};
+        if( u < 0 || i >= n || ! (in_frontier[i/64] >> (i%64) & 1) ) continue;
+        test_and_set(v);
+        level[v] = depth+1;
+        buffers[t].push_back(static_cast<T>(v));
+        degrees[t] += out_degree(static_cast<T>(v));
+        break;
+      } // for: u
+    } // for: v
+  };
+
+  auto worker = [&](size_t t)
+  {
+    while( ! done )
+    {
+      if( bottom_up ) { bottom_up_step(t); } else { top_down(t); }
+      sync.arrive_and_wait();
+    } // while
+  };
+
+  {
+    std::vector<std::jthread> pool;
+    for (size_t t{1}; t < threads; ++t) { pool.emplace_back(worker, t); }
+    worker(0);
+  } // join
+
+  return {result, level};
+} // function: parallel_bfs
+
+} // namespace celaeno::graph::parallel_bfs
@@ -0,0 +1,305 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : route
+// @created     : Saturday Oct 17, 2026 03:34:51 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <celaeno/graph/a-star.hpp>
+
+namespace celaeno::graph::route
+{
+//
+// Aliases
+//
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+using Cell = std::pair<int64_t,int64_t>;
+using Path = std::deque<Cell>;
+
+//
+// Types
+//
+
+// Two terminals to connect
+struct Net
+{
+  Cell source;
+  Cell target;
+};
+
+// Negotiation parameters, a cell shared by more nets than its capacity costs
+// (1 + history) * (1 + present * excess), where present is multiplied by
+// present_growth and history accumulates history_factor * excess after each
+// iteration
+struct Options
+{
+  size_t iterations{50};
+  int32_t capacity{1};
+  float64_t present{0.5};
+  float64_t present_growth{1.5};
+  float64_t history_factor{1.0};
+};
+
+struct Result
+{
+  // Path of each net, empty when the net could not be connected
+  std::vector<Path> paths;
+  // Every net has a path and no cell is used by more nets than its capacity
+  bool legal{false};
+  // Negotiation iterations run
+  size_t iterations{0};
+  // Searches run over all iterations
+  size_t searches{0};
+  // Nets without a path, in increasing order
+  std::vector<size_t> unrouted{};
+};
+
+// Two terminals to connect with their own cost of entering a cell
+struct Request
+{
+  Cell source;
+  Cell target;
+  std::function<float64_t(Cell const&)> f_distance;
+};
+
+//
+// Helpers
+//
+
+// Bounding box of the terminals of a request grown by margin and clipped to
+// bounds, the searches of a request never leave it
+inline a_star::Bounds window(a_star::Bounds const& bounds, Cell const& s, Cell const& t, int64_t margin)
+{
+  return a_star::Bounds{
+    {std::max(bounds.min.first, std::min(s.first,t.first)-margin),
+      std::max(bounds.min.second, std::min(s.second,t.second)-margin)},
+    {std::min(bounds.max.first, std::max(s.first,t.first)+margin),
+      std::min(bounds.max.second, std::max(s.second,t.second)+margin)}
+  };
+}
+
+// Groups of windows connected by overlaps, each group in increasing
+// index order and the groups ordered by their first index
+inline std::vector<std::vector<size_t>> groups(std::vector<a_star::Bounds> const& windows)
+{
+  // Union-find with the lowest index as the root
+  std::vector<size_t> parent(windows.size());
+  std::iota(parent.begin(), parent.end(), size_t{0});
+  auto find = [&parent](size_t i)
+  {
+    while( parent[i] != i ) { i = parent[i] = parent[parent[i]]; }
+    return i;
+  };
+
+  // Sweep the windows by their first row, keeping the ones whose rows
+  // are still open
+  std::vector<size_t> by_row(windows.size());
+  std::iota(by_row.begin(), by_row.end(), size_t{0});
+  std::ranges::sort(by_row, {}, [&windows](size_t i){ return windows[i].min.first; });
+
+  std::vector<size_t> active;
+  for (auto const& i : by_row)
+  {
+    auto const& w {windows[i]};
+    std::erase_if(active, [&](size_t j){ return windows[j].max.first < w.min.first; });
+    for (auto const& j : active)
+    {
+      auto const& v {windows[j]};
+      if( v.min.second <= w.max.second && w.min.second <= v.max.second )
+      {
+        auto [a,b] {std::make_pair(find(i), find(j))};
+        if( a < b ) { parent[b] = a; } else { parent[a] = b; }
+      } // if
+    } // for: j
+    active.push_back(i);
+  } // for: i
+
+  std::vector<std::vector<size_t>> result;
+  std::vector<size_t> group(windows.size());
+  for (size_t i{0}; i < windows.size(); ++i)
+  {
+    auto r {find(i)};
+    if( r == i ) { group[i] = result.size(); result.emplace_back(); }
+    result[group[r]].push_back(i);
+  } // for: i
+
+  return result;
+} // function: groups
+
+//
+// Algorithm
+//
+
+// PathFinder-style negotiated congestion routing of nets on a bounded grid.
+// Every net is routed once, then each iteration rips up and re-routes only
+// the nets that go through an overused cell, with the congestion costs fed
+// to a_star as f_distance. Stops as soon as no cell is overused or after
+// options.iterations. Nets whose terminals are not connected are left with
+// an empty path and listed in unrouted. f_heuristic(cell, target) must not overestimate the
+// number of cells to target.
+template<typename F1, typename F2>
+Result route(a_star::Bounds const& bounds, std::vector<Net> const& nets,
+  F1&& f_neighbors, F2&& f_heuristic, Options const& options = {})
+{
+  std::vector<int32_t> occupancy(bounds.size(), 0);
+  std::vector<float64_t> history(bounds.size(), 0.);
+  auto present {options.present};
+
+  Result result{std::vector<Path>(nets.size()), false, 0, 0};
+  a_star::SearchContext<> ctx;
+
+  auto excess = [&](int64_t i)
+  {
+    return std::max(0, occupancy[static_cast<size_t>(i)] + 1 - options.capacity);
+  };
+
+  auto cost = [&](auto&& n) -> float64_t
+  {
+    auto i {bounds.index(n)};
+    return (1. + history[static_cast<size_t>(i)]) * (1. + present * excess(i));
+  };
+
+  auto occupy = [&](Path const& path, int32_t delta)
+  {
+    for (auto const& c : path) { occupancy[static_cast<size_t>(bounds.index(c))] += delta; }
+  };
+
+  auto overused = [&](Path const& path)
+  {
+    return std::ranges::any_of(path, [&](auto const& c)
+      { return occupancy[static_cast<size_t>(bounds.index(c))] > options.capacity; });
+  };
+
+  std::vector<size_t> pending(nets.size());
+  for (size_t i{0}; i < pending.size(); ++i) { pending[i] = i; }
+  bool within{false};
+
+  while( result.iterations < options.iterations )
+  {
+    ++result.iterations;
+
+    // Rip up and re-route the pending nets against the current costs
+    for (auto const& i : pending)
+    {
+      auto& path {result.paths[i]};
+      occupy(path, -1);
+      auto const& target {nets[i].target};
+      auto heuristic = [&](auto&& n) -> float64_t { return f_heuristic(n, target); };
+      path = a_star::a_star(bounds, nets[i].source, target, f_neighbors, cost, heuristic, ctx);
+      occupy(path, 1);
+      ++result.searches;
+    } // for: i
+
+    // Grow the history of the overused cells
+    within = true;
+    for (size_t c{0}; c < occupancy.size(); ++c)
+    {
+      if( occupancy[c] > options.capacity )
+      {
+        history[c] += options.history_factor * (occupancy[c] - options.capacity);
+        within = false;
+      } // if
+    } // for: c
+
+    if( within ) { break; }
+
+    present *= options.present_growth;
+
+    // Only the nets through an overused cell are routed again
+    pending.clear();
+    for (size_t i{0}; i < nets.size(); ++i)
+    {
+      if( overused(result.paths[i]) ) { pending.push_back(i); }
+    } // for: i
+  } // while
+
+  for (size_t i{0}; i < nets.size(); ++i)
+  {
+    if( result.paths[i].empty() ) { result.unrouted.push_back(i); }
+  } // for: i
+  result.legal = within && result.unrouted.empty();
+
+  return result;
+} // function: route
+
+// Route independent requests concurrently. Each request is searched inside
+// its window (the bounding box of its terminals grown by margin), requests
+// with overlapping windows form a group that one worker routes in request
+// order, and groups never share a cell. Each worker keeps its own
+// a_star::SearchContext. The paths are returned in request order and do not
+// depend on the number of threads. f_neighbors and f_heuristic are called
+// concurrently and must be safe to call from several threads; f_distance of
+// a request may update per-cell state inside its window.
+template<typename F1, typename F2>
+std::vector<Path> batch(a_star::Bounds const& bounds, std::vector<Request> const& requests,
+  F1&& f_neighbors, F2&& f_heuristic, int64_t margin = 0,
+  size_t threads = std::max(1u, std::thread::hardware_concurrency()))
+{
+  std::vector<a_star::Bounds> windows;
+  for (auto const& r : requests) { windows.push_back(window(bounds, r.source, r.target, margin)); }
+
+  auto work {groups(windows)};
+  std::vector<Path> result(requests.size());
+  std::atomic<size_t> next{0};
+
+  auto worker = [&]()
+  {
+    a_star::SearchContext<> ctx;
+    for (auto g {next++}; g < work.size(); g = next++)
+    {
+      for (auto const& i : work[g])
+      {
+        auto const& r {requests[i]};
+        auto heuristic = [&](auto&& n) -> float64_t { return f_heuristic(n, r.target); };
+        result[i] = a_star::a_star(windows[i], r.source, r.target, f_neighbors, r.f_distance, heuristic, ctx);
+      } // for: i
+    } // for: g
+  };
+
+  threads = std::clamp<size_t>(threads, 1, std::max<size_t>(work.size(), 1));
+  {
+    std::vector<std::jthread> pool;
+    for (size_t t{1}; t < threads; ++t) { pool.emplace_back(worker); }
+    worker();
+  }
+
+  return result;
+} // function: batch
+
+} // namespace celaeno::graph::route
@@ -0,0 +1,119 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : traversal
+// @created     : Saturday Oct 17, 2026 08:19:13 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+#include <concepts>
+#include <range/v3/all.hpp>
+
+namespace celaeno::graph::traversal
+{
+
+//
+// Aliases
+//
+namespace rg = ranges;
+
+//
+// Concepts
+//
+
+// Each call expands the vertex returned by the previous call and returns the
+// next vertex of the traversal, or nothing once it is over
+template<typename S, typename T>
+concept Step = requires(S s){ {s()} -> std::same_as<std::optional<T>>; };
+
+//
+// Lazy view
+//
+// Input view over the vertices returned by a step, computing each one when
+// the iterator is incremented. Copies share the traversal.
+//
+template<std::signed_integral T, Step<T> S>
+class Lazy : public rg::view_base
+{
+  private:
+    struct State
+    {
+      S step;
+      std::optional<T> current{};
+
+      void advance() { current = step(); }
+    }; // struct: State
+
+  public:
+    struct sentinel {};
+
+    class iterator
+    {
+      public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::input_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+
+        iterator() = default;
+        explicit iterator(State* state) : m_state(state) {}
+
+        T operator*() const { return *m_state->current; }
+        iterator& operator++() { m_state->advance(); return *this; }
+        iterator operator++(int) { auto it{*this}; m_state->advance(); return it; }
+
+        friend bool operator==(iterator const& it, sentinel)
+        {
+          return ! it.m_state || ! it.m_state->current;
+        }
+
+      private:
+        State* m_state{nullptr};
+    }; // class: iterator
+
+    Lazy() = default;
+
+    explicit Lazy(S step)
+      : m_state{std::make_shared<State>(State{std::move(step)})}
+    {
+      m_state->advance();
+    }
+
+    iterator begin() const { return iterator{m_state.get()}; }
+    sentinel end() const { return {}; }
+
+  private:
+    std::shared_ptr<State> m_state{};
+}; // class: Lazy
+
+} // namespace celaeno::graph::traversal
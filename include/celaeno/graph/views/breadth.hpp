@@ -40,15 +40,19 @@
 #include <fplus/fplus.hpp>
 #include <range/v3/all.hpp>
 #include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/visited.hpp>
 
 namespace celaeno::graph::views::breadth
 {
 
-template<typename T, typename F1, typename F2>
+template<typename T, typename F1, typename F2,
+  typename V = celaeno::graph::visited::Hash<std::decay_t<T>>>
+  requires celaeno::graph::visited::Visited<std::remove_cvref_t<V>,std::decay_t<T>>
 auto breadth(
   T&& root,
   F1&& pred,
-  F2&& succ
+  F2&& succ,
+  V&& visited = V{}
 )
 {
   using Vertex = std::decay_t<T>;
@@ -59,9 +63,7 @@ auto breadth(
   namespace fw = fplus::fwd;
 
   // Create depth map
-  auto depth {celaeno::graph::views::depth::depth(root,pred,succ)};
-  auto& map_lv{depth.first};
-  auto& map_vl{depth.second};
+  auto depth {celaeno::graph::views::depth::flat(static_cast<Vertex>(root),pred,succ)};
 
   std::deque<Vertex> deque;
 
@@ -74,9 +76,6 @@ auto breadth(
   // Insert initial vertex in deque
   deque.push_front(root);
 
-  // Visited nodes
-  std::unordered_map<Vertex,bool> visited;
-
   // Detect all subtrees
   while (! deque.empty())
   {
@@ -88,15 +87,15 @@ auto breadth(
     }
     else
     {
-      visited.insert({current,true});
+      visited.insert(current);
     }
 
     auto p {pred(current)};
     auto s {succ(current)};
 
     // If there is another vertex in this column & depth
-    auto same_depth = [&map_vl,&current](auto&& e)
-      { return map_vl.at(e.first) == map_vl.at(current); };
+    auto same_depth = [&depth,&current](auto&& e)
+      { return depth.level(e.first) == depth.level(current); };
     auto same_column = [&column](auto&& e)
       { return e.second == column; };
     auto same_depth_column = [&same_depth,&same_column](auto&& e)
@@ -104,15 +103,8 @@ auto breadth(
 
     if( rg::find_if(hash, same_depth_column) != rg::end(hash) )
     {
-      // Get the depth of current
-      auto depth_of_current { map_vl.at(current) };
       // Get all the vertices in level of current
-      auto range{map_lv.equal_range(depth_of_current)};
-      std::vector<T> siblings;
-      for(auto it{range.first}; it!=range.second; ++it)
-      {
-        siblings.push_back(it->second);
-      }
+      auto siblings { depth.vertices(depth.level(current)) };
       auto max_column{column};
       for( auto const& s : siblings )
       {
@@ -34,9 +34,17 @@
 
 #include <set>
 #include <map>
+#include <span>
+#include <vector>
+#include <ranges>
+#include <limits>
+#include <unordered_map>
+#include <numeric>
+#include <algorithm>
 #include <range/v3/all.hpp>
 #include <fplus/fplus.hpp>
 #include <celaeno/graph/kahn.hpp>
+#include <celaeno/graph/visited.hpp>
 #include <type_traits>
 
 namespace celaeno::graph::views::depth
@@ -55,14 +63,207 @@ namespace kahn = celaeno::graph::kahn;
 //
 
 template<typename T>
-concept Iterable = requires{ std::input_iterator<T> && std::incrementable<T>; };
+concept Iterable = std::ranges::input_range<T>;
 template<typename T>
 concept Function = requires(T t) { {t(int64_t{})} -> Iterable; };
 
+//
+// Vertex index
+//
+// Position of each vertex in a vector of distinct ids. Ids within a few
+// times the vertex count of each other are addressed directly, sparser ids
+// (e.g. grid coordinates packed by a pairing function) are hashed.
+//
+template<std::signed_integral T>
+class Index
+{
+  public:
+    static constexpr size_t npos {std::numeric_limits<size_t>::max()};
+
+    Index() = default;
+
+    explicit Index(std::span<T const> vertices)
+    {
+      if( vertices.empty() ) return;
+      auto [lo,hi] {std::ranges::minmax(vertices)};
+      m_min = lo;
+      m_max = hi;
+
+      if( offset(hi) < s_spread*vertices.size() + s_slack )
+      {
+        m_dense.assign(static_cast<size_t>(offset(hi))+1, npos);
+        for (size_t i{0}; i < vertices.size(); ++i) { m_dense[static_cast<size_t>(offset(vertices[i]))] = i; }
+        return;
+      } // if
+
+      m_hashed.reserve(vertices.size());
+      for (size_t i{0}; i < vertices.size(); ++i) { m_hashed.emplace(vertices[i], i); }
+    }
+
+    // Position of v, npos for ids outside the index
+    size_t find(T v) const noexcept
+    {
+      if( m_hashed.empty() )
+      {
+        auto i {offset(v)};
+        return (i < m_dense.size())? m_dense[static_cast<size_t>(i)] : npos;
+      } // if
+      auto it {m_hashed.find(v)};
+      return (it == m_hashed.end())? npos : it->second;
+    }
+
+    // Lowest and highest indexed ids
+    T min() const noexcept { return m_min; }
+    T max() const noexcept { return m_max; }
+
+  private:
+    using U = std::make_unsigned_t<T>;
+
+    // Distance from the lowest id, ids below it wrap past the dense range
+    U offset(T v) const noexcept { return static_cast<U>(static_cast<U>(v) - static_cast<U>(m_min)); }
+
+    static constexpr size_t s_spread {4};
+    static constexpr size_t s_slack {64};
+
+    T m_min{0};
+    T m_max{-1};
+    std::vector<size_t> m_dense{};
+    std::unordered_map<T,size_t> m_hashed{};
+}; // class: Index
+
+//
+// Flat depth view
+//
+// Level of each vertex and the vertices of each level, in contiguous arrays.
+// Levels are stored by position in the bucketed vertices and found through
+// an Index, so ids need not be compact.
+//
+template<std::signed_integral T>
+class Flat
+{
+  public:
+    Flat() = default;
+
+    // Vertices grouped by level, level l spans [offsets[l],offsets[l+1])
+    Flat(std::vector<T> vertices, std::vector<size_t> offsets)
+      : m_vertices{std::move(vertices)}
+      , m_offsets{std::move(offsets)}
+      , m_index{m_vertices}
+      , m_level(m_vertices.size())
+    {
+      for (size_t l{0}; l < height(); ++l)
+      {
+        std::fill(m_level.begin()+static_cast<int64_t>(m_offsets[l]),
+          m_level.begin()+static_cast<int64_t>(m_offsets[l+1]), static_cast<int64_t>(l));
+      } // for: l
+    }
+
+    // Level of v, -1 for vertices outside the view
+    int64_t level(T v) const noexcept
+    {
+      auto i {m_index.find(v)};
+      return (i == Index<T>::npos)? -1 : m_level[i];
+    }
+
+    // Vertices on level l, in topological order
+    std::span<T const> vertices(int64_t l) const noexcept
+    {
+      if( l < 0 || static_cast<size_t>(l) >= height() ) return {};
+      auto i {static_cast<size_t>(l)};
+      return {m_vertices.data()+m_offsets[i], m_offsets[i+1]-m_offsets[i]};
+    }
+
+    // All vertices grouped by level
+    std::span<T const> vertices() const noexcept { return m_vertices; }
+
+    // Number of levels
+    size_t height() const noexcept { return m_offsets.empty()? 0 : m_offsets.size()-1; }
+
+    // Lowest and highest ids in the view
+    T min() const noexcept { return m_index.min(); }
+    T max() const noexcept { return m_index.max(); }
+
+  private:
+    std::vector<T> m_vertices{};
+    std::vector<size_t> m_offsets{};
+    Index<T> m_index{};
+    std::vector<int64_t> m_level{};
+}; // class: Flat
+
 //
 // Algorithm
 //
 
+// Longest-path levels of the vertices weakly connected to root, computed
+// during the topological pass itself: each predecessor pushes its level to
+// its successors as its edges are removed, so pred is called once per vertex
+// and only while counting in-degrees.
+template<std::signed_integral T, Function F1, Function F2>
+Flat<T> flat(T root, F1&& pred, F2&& succ)
+{
+  // Breadth-first discovery through predecessors and successors,
+  // the queue is the discovered prefix of vertices
+  std::vector<T> vertices{root};
+  std::vector<int64_t> degree;
+  celaeno::graph::visited::Hash<T> seen;
+  seen.insert(root);
+
+  for (size_t i{0}; i < vertices.size(); ++i)
+  {
+    auto v {vertices[i]};
+    int64_t count{0};
+    for (auto&& p : pred(v))
+    {
+      ++count;
+      if( seen.insert(p) ) { vertices.push_back(p); }
+    } // for: p
+    for (auto&& s : succ(v))
+    {
+      if( seen.insert(s) ) { vertices.push_back(s); }
+    } // for: s
+    degree.push_back(count);
+  } // for: i
+
+  // Levels and counters by discovery position
+  Index<T> index{vertices};
+  auto at = [&index](T v){ return index.find(v); };
+  std::vector<int64_t> level(vertices.size(), -1);
+  std::vector<int64_t> remaining(degree);
+
+  // Kahn's algorithm over in-degree counters, the order vector is the queue
+  std::vector<T> order;
+  order.reserve(vertices.size());
+  for (size_t i{0}; i < vertices.size(); ++i)
+  {
+    if( degree[i] == 0 ) { order.push_back(vertices[i]); level[i] = 0; }
+  } // for: i
+
+  for (size_t i{0}; i < order.size(); ++i)
+  {
+    auto next_level {level[at(order[i])]+1};
+    for (auto&& s : succ(order[i]))
+    {
+      auto j {at(s)};
+      level[j] = std::max(level[j], next_level);
+      if( --remaining[j] == 0 ) { order.push_back(s); }
+    } // for: s
+  } // for: i
+
+  // Bucket the vertices by level with a counting sort, stable on the
+  // topological order
+  int64_t height{0};
+  for (auto const& v : order) { height = std::max(height, level[at(v)]+1); }
+  std::vector<size_t> offsets(static_cast<size_t>(height)+1, 0);
+  for (auto const& v : order) { ++offsets[static_cast<size_t>(level[at(v)])+1]; }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<T> buckets(order.size());
+  std::vector<size_t> fill(offsets.begin(), offsets.end()-1);
+  for (auto const& v : order) { buckets[fill[static_cast<size_t>(level[at(v)])]++] = v; }
+
+  return Flat<T>{std::move(buckets), std::move(offsets)};
+} // flat
+
 template<std::signed_integral T, Function F1, Function F2>
 std::pair<std::multimap<T,T>,std::map<T,T>>
   depth(T root, F1&& pred, F2&& succ)
@@ -72,41 +273,18 @@ std::pair<std::multimap<T,T>,std::map<T,T>>
   // node -> level
   std::map<T,T> m_rev;
 
-  auto topo_sort
+  auto view {flat(root, std::forward<F1>(pred), std::forward<F2>(succ))};
+
+  for (size_t l{0}; l < view.height(); ++l)
   {
-    kahn::kahn(
-      std::forward<T>(root),
-      std::forward<F1>(pred),
-      std::forward<F2>(succ),
-      [&pred,&m,&m_rev](auto&& v_curr) -> bool
-      {
-        if( pred(v_curr).size() == 0 )
-        {
-          m.emplace(0,v_curr);
-          m_rev.emplace(v_curr,0);
-        } // if
-        else
-        {
-          // Get siblings
-          // Get their levels
-          // Get the max value
-          auto level
-          {
-            fw::apply(
-              pred(v_curr)
-              , fw::transform([&m_rev](auto&& v_sib){ return m_rev.at(v_sib); })
-              , fw::maximum()
-            )
-          };
-          m.emplace(level+1,v_curr);
-          m_rev.emplace(v_curr,level+1);
-        } // else
-        return false;
-      } // lambda
-    ) // kahn's algorithm
-  };
-
-  return std::make_pair(m,m_rev);
+    for (auto const& v : view.vertices(static_cast<int64_t>(l)))
+    {
+      m.emplace_hint(m.end(), static_cast<T>(l), v);
+      m_rev.emplace(v, static_cast<T>(l));
+    } // for: v
+  } // for: l
+
+  return std::make_pair(std::move(m),std::move(m_rev));
 } // depth_view
 
 } // namespace celaeno::graph::view::depth
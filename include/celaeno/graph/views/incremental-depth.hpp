@@ -0,0 +1,270 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : incremental-depth
+// @created     : Saturday Oct 17, 2026 03:24:10 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <queue>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <celaeno/graph/views/depth.hpp>
+
+namespace celaeno::graph::views::incremental_depth
+{
+//
+// Aliases
+//
+namespace depth = celaeno::graph::views::depth;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept Iterable = std::ranges::input_range<T>;
+template<typename T>
+concept Function = requires(T t) { {t(int64_t{})} -> Iterable; };
+
+//
+// Incremental depth view
+//
+// Longest-path levels kept up to date under edge edits. The owner mutates the
+// graph and then reports the edit through link/unlink; only the vertices
+// downstream of the edit are visited, in increasing level order. When a
+// repair exceeds its relaxation bound (e.g. the edit closed a cycle) the
+// levels are rebuilt from the root with depth::flat. Linking to a vertex
+// outside the view brings in its whole component. Vertices leave the view
+// only once they are left without edges.
+//
+template<std::signed_integral T, Function F1, Function F2>
+class Depth
+{
+  public:
+    // bound: relaxations allowed per edit, 0 means the vertex count
+    Depth(T root, F1 pred, F2 succ, size_t bound = 0)
+      : m_root{root}
+      , m_pred{std::move(pred)}
+      , m_succ{std::move(succ)}
+      , m_bound{bound}
+    {
+      rebuild();
+    }
+
+    // The wrappers returned by subscribe point back at this view
+    Depth(Depth const&) = delete;
+    Depth(Depth&&) = delete;
+    Depth& operator=(Depth const&) = delete;
+    Depth& operator=(Depth&&) = delete;
+
+    // Level of v, -1 for vertices outside the view
+    int64_t level(T v) const noexcept
+    {
+      auto it {m_level.find(v)};
+      return (it == m_level.end())? -1 : it->second;
+    }
+
+    // Number of levels
+    size_t height() const noexcept { return m_count.size(); }
+
+    // Number of vertices in the view
+    size_t size() const noexcept { return m_level.size(); }
+
+    // Number of full rebuilds performed since construction
+    size_t rebuilds() const noexcept { return m_rebuilds; }
+
+    // Edge (u,v) was inserted in the graph
+    template<typename P>
+    void link(P&& edge)
+    {
+      auto [u,v] {edge};
+      discover(u);
+      discover(v);
+      push(v);
+      repair();
+    }
+
+    // Edge (u,v) was removed from the graph
+    template<typename P>
+    void unlink(P&& edge)
+    {
+      auto [u,v] {edge};
+      if( ! m_level.contains(v) ) { return; }
+      push(v);
+      repair();
+      // Vertices left without edges leave the view
+      for (auto const& w : {u,v})
+      {
+        if( m_level.contains(w) && isolated(w) ) { erase(w); }
+      } // for: w
+    }
+
+    // Wrap the graph mutators so that each edit is reported to the view
+    template<typename L, typename U>
+    auto subscribe(L&& link, U&& unlink)
+    {
+      return std::make_pair(
+        [this,link=std::forward<L>(link)](auto&& edge) mutable
+          { std::invoke(link, edge); this->link(edge); },
+        [this,unlink=std::forward<U>(unlink)](auto&& edge) mutable
+          { std::invoke(unlink, edge); this->unlink(edge); }
+      );
+    }
+
+  private:
+    // Recompute the levels of the queued vertices from their predecessors,
+    // lowest level first, queueing the successors of every vertex that moves
+    void repair()
+    {
+      size_t bound {(m_bound == 0)? m_level.size() : m_bound};
+      size_t relaxations{0};
+
+      while( ! m_queue.empty() )
+      {
+        auto [key,v] {m_queue.top()};
+        m_queue.pop();
+        if( ! m_queued.erase(v) ) { continue; }
+
+        if( ++relaxations > bound )
+        {
+          rebuild();
+          return;
+        } // if
+
+        int64_t l{0};
+        for (auto&& p : m_pred(v))
+        {
+          if( ! m_level.contains(p) ) { assign(p, 0); push(p); }
+          l = std::max(l, m_level.at(p)+1);
+        } // for: p
+
+        if( auto it {m_level.find(v)}; it != m_level.end() && l == it->second )
+        {
+          continue;
+        } // if
+
+        assign(v, l);
+        for (auto&& s : m_succ(v)) { push(s); }
+      } // while
+    }
+
+    // Queue every vertex reachable from v through vertices outside the view,
+    // entering them at level 0 for repair to settle
+    void discover(T v)
+    {
+      if( m_level.contains(v) ) { return; }
+      std::vector<T> stack{v};
+      assign(v, 0);
+      push(v);
+      while( ! stack.empty() )
+      {
+        auto w {stack.back()};
+        stack.pop_back();
+        auto visit = [&](T x)
+        {
+          if( m_level.contains(x) ) { return; }
+          assign(x, 0);
+          push(x);
+          stack.push_back(x);
+        };
+        for (auto&& p : m_pred(w)) { visit(p); }
+        for (auto&& s : m_succ(w)) { visit(s); }
+      } // while
+    }
+
+    void rebuild()
+    {
+      auto view {depth::flat(m_root, m_pred, m_succ)};
+      m_level.clear();
+      m_count.clear();
+      m_queue = {};
+      m_queued.clear();
+      for (auto const& v : view.vertices()) { assign(v, view.level(v)); }
+      ++m_rebuilds;
+    }
+
+    void push(T v)
+    {
+      if( m_queued.insert(v).second ) { m_queue.emplace(level(v), v); }
+    }
+
+    void assign(T v, int64_t l)
+    {
+      auto [it,inserted] {m_level.try_emplace(v, l)};
+      if( ! inserted ) { uncount(it->second); it->second = l; }
+      if( m_count.size() <= static_cast<size_t>(l) ) { m_count.resize(static_cast<size_t>(l)+1, 0); }
+      ++m_count[static_cast<size_t>(l)];
+    }
+
+    void erase(T v)
+    {
+      uncount(m_level.at(v));
+      m_level.erase(v);
+    }
+
+    void uncount(int64_t l)
+    {
+      --m_count[static_cast<size_t>(l)];
+      while( ! m_count.empty() && m_count.back() == 0 ) { m_count.pop_back(); }
+    }
+
+    bool isolated(T v)
+    {
+      auto&& p {m_pred(v)};
+      auto&& s {m_succ(v)};
+      return std::ranges::empty(p) && std::ranges::empty(s);
+    }
+
+    T m_root;
+    F1 m_pred;
+    F2 m_succ;
+    size_t m_bound;
+    size_t m_rebuilds{0};
+    std::unordered_map<T,int64_t> m_level{};
+    std::vector<int64_t> m_count{};
+    std::priority_queue<std::pair<int64_t,T>,
+      std::vector<std::pair<int64_t,T>>, std::greater<>> m_queue{};
+    std::unordered_set<T> m_queued{};
+}; // class: Depth
+
+//
+// Algorithm
+//
+
+template<std::signed_integral T, Function F1, Function F2>
+auto incremental(T root, F1&& pred, F2&& succ, size_t bound = 0)
+{
+  return Depth<T,std::decay_t<F1>,std::decay_t<F2>>{
+    root, std::forward<F1>(pred), std::forward<F2>(succ), bound};
+} // incremental
+
+} // namespace celaeno::graph::views::incremental_depth
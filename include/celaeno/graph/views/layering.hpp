@@ -0,0 +1,523 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : layering
+// @created     : Saturday Oct 17, 2026 04:16:35 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <limits>
+#include <queue>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <celaeno/graph/views/depth.hpp>
+
+namespace celaeno::graph::views::layering
+{
+//
+// Aliases
+//
+namespace depth = celaeno::graph::views::depth;
+
+//
+// Network simplex
+//
+// Layering of the vertices of a depth view that minimizes the total span of
+// the edges, i.e., the pseudo vertices balance has to insert (Gansner et al.,
+// "A technique for drawing directed graphs", 1993). A virtual root drives
+// every source of the view through an edge heavy enough to stay tight, so
+// the sources remain on level 0 and the balanced graph has the same levels
+// under depth::flat. Trees are kept as parent edges with low/lim postorder
+// ranges, every traversal uses an explicit stack.
+//
+template<std::signed_integral T>
+class Network
+{
+  public:
+    template<depth::Function F>
+    Network(depth::Flat<T> const& view, F&& pred)
+    {
+      // Vertices indexed by position in the view, the virtual root goes last
+      auto vertices {view.vertices()};
+      m_vertices.assign(vertices.begin(), vertices.end());
+      auto n {m_vertices.size()};
+      depth::Index<T> index{m_vertices};
+      m_rank.resize(n+1);
+      for (size_t i{0}; i < n; ++i) { m_rank[i] = view.level(m_vertices[i]); }
+      m_rank[n] = -1;
+
+      // Edges between vertices of the view, then the edges of the root
+      std::vector<bool> source(n, true);
+      int64_t total{0};
+      for (size_t i{0}; i < n; ++i)
+      {
+        for (auto&& p : pred(m_vertices[i]))
+        {
+          if( view.level(p) < 0 ) continue;
+          auto u {static_cast<int64_t>(index.find(static_cast<T>(p)))};
+          edge(u, static_cast<int64_t>(i), 1);
+          total += m_rank[i] - m_rank[static_cast<size_t>(u)];
+          source[i] = false;
+        } // for: p
+      } // for: i
+
+      // Lowering a source costs more than the whole span can shrink
+      auto heavy {total - static_cast<int64_t>(m_tail.size()) + 1};
+      for (size_t i{0}; i < n; ++i)
+      {
+        if( source[i] ) { edge(static_cast<int64_t>(n), static_cast<int64_t>(i), heavy); }
+      } // for: i
+
+      // Incidence lists
+      m_out.assign(n+2, 0);
+      m_in.assign(n+2, 0);
+      for (size_t e{0}; e < m_tail.size(); ++e)
+      {
+        ++m_out[static_cast<size_t>(m_tail[e])+1];
+        ++m_in[static_cast<size_t>(m_head[e])+1];
+      } // for: e
+      std::partial_sum(m_out.begin(), m_out.end(), m_out.begin());
+      std::partial_sum(m_in.begin(), m_in.end(), m_in.begin());
+      m_out_edges.resize(m_tail.size());
+      m_in_edges.resize(m_tail.size());
+      std::vector<size_t> fill_out(m_out.begin(), m_out.end()-1);
+      std::vector<size_t> fill_in(m_in.begin(), m_in.end()-1);
+      for (size_t e{0}; e < m_tail.size(); ++e)
+      {
+        m_out_edges[fill_out[static_cast<size_t>(m_tail[e])]++] = static_cast<int64_t>(e);
+        m_in_edges[fill_in[static_cast<size_t>(m_head[e])]++] = static_cast<int64_t>(e);
+      } // for: e
+    }
+
+    // Pivot until no tree edge has a negative cut value, or iterations run
+    // out. Returns the number of pivots.
+    int64_t run(int64_t iterations)
+    {
+      feasible_tree();
+      auto root {static_cast<int64_t>(m_vertices.size())};
+      range(root, -1, 0);
+      cut_values();
+
+      int64_t pivots{0};
+      for (int64_t e; pivots < iterations && (e = leave()) >= 0; ++pivots)
+      {
+        auto f {enter(e)};
+        if( f < 0 ) break;
+        update(e, f);
+      } // for: pivots
+      return pivots;
+    }
+
+    // Depth view with the current ranks
+    depth::Flat<T> view() const
+    {
+      auto n {m_vertices.size()};
+      auto base {m_rank[n]+1};
+      int64_t height{0};
+      for (size_t i{0}; i < n; ++i) { height = std::max(height, m_rank[i]-base+1); }
+
+      std::vector<size_t> offsets(static_cast<size_t>(height)+1, 0);
+      for (size_t i{0}; i < n; ++i) { ++offsets[static_cast<size_t>(m_rank[i]-base)+1]; }
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+      // Counting sort, stable on the order of the input view
+      std::vector<T> buckets(n);
+      std::vector<size_t> fill(offsets.begin(), offsets.end()-1);
+      for (size_t i{0}; i < n; ++i) { buckets[fill[static_cast<size_t>(m_rank[i]-base)]++] = m_vertices[i]; }
+
+      return depth::Flat<T>{std::move(buckets), std::move(offsets)};
+    }
+
+  private:
+    void edge(int64_t u, int64_t v, int64_t weight)
+    {
+      m_tail.push_back(u);
+      m_head.push_back(v);
+      m_weight.push_back(weight);
+    }
+
+    int64_t slack(int64_t e) const noexcept
+    {
+      return m_rank[static_cast<size_t>(m_head[e])] - m_rank[static_cast<size_t>(m_tail[e])] - 1;
+    }
+
+    int64_t other(int64_t e, int64_t v) const noexcept { return (m_tail[e] == v)? m_head[e] : m_tail[e]; }
+
+    // Whether w lies in the subtree of v
+    bool below(int64_t w, int64_t v) const noexcept
+    {
+      auto const i {static_cast<size_t>(v)};
+      auto const lim {m_lim[static_cast<size_t>(w)]};
+      return m_low[i] <= lim && lim <= m_lim[i];
+    }
+
+    void tree_insert(int64_t e)
+    {
+      m_tree[static_cast<size_t>(e)] = true;
+      m_tree_edges[static_cast<size_t>(m_tail[e])].push_back(e);
+      m_tree_edges[static_cast<size_t>(m_head[e])].push_back(e);
+    }
+
+    void tree_erase(int64_t e)
+    {
+      m_tree[static_cast<size_t>(e)] = false;
+      for (auto v : {m_tail[e], m_head[e]}) { std::erase(m_tree_edges[static_cast<size_t>(v)], e); }
+    }
+
+    //
+    // Initial tree
+    //
+
+    // Grow a spanning tree of tight edges from the root. Whenever no tight
+    // edge leaves the tree, the tree moves as a whole by the least slack of
+    // the edges that leave it; the tree ranks are stored relative to an
+    // offset so the move is O(1), and the heaps key each edge by the part of
+    // its slack that does not depend on the offset.
+    void feasible_tree()
+    {
+      auto n {m_rank.size()};
+      m_tree.assign(m_tail.size(), false);
+      m_tree_edges.assign(n, {});
+
+      using Entry = std::pair<int64_t,int64_t>;
+      std::priority_queue<Entry,std::vector<Entry>,std::greater<>> out, in;
+      std::vector<bool> inside(n, false);
+      std::vector<int64_t> members;
+      int64_t offset{0};
+
+      auto add = [&](int64_t v)
+      {
+        auto const i {static_cast<size_t>(v)};
+        inside[i] = true;
+        members.push_back(v);
+        m_rank[i] -= offset;
+        for (auto k{m_out[i]}; k < m_out[i+1]; ++k)
+        {
+          auto e {m_out_edges[k]};
+          auto h {static_cast<size_t>(m_head[e])};
+          if( ! inside[h] ) { out.emplace(m_rank[h] - m_rank[i] - 1, e); }
+        } // for: k
+        for (auto k{m_in[i]}; k < m_in[i+1]; ++k)
+        {
+          auto e {m_in_edges[k]};
+          auto t {static_cast<size_t>(m_tail[e])};
+          if( ! inside[t] ) { in.emplace(m_rank[i] - m_rank[t] - 1, e); }
+        } // for: k
+      };
+
+      auto settled = [&](auto& heap)
+      {
+        while( ! heap.empty() )
+        {
+          auto e {heap.top().second};
+          if( ! inside[static_cast<size_t>(m_tail[e])] || ! inside[static_cast<size_t>(m_head[e])] ) break;
+          heap.pop();
+        } // while
+      };
+
+      // Every vertex hangs from the root through its sources
+      add(static_cast<int64_t>(n-1));
+      while( true )
+      {
+        settled(out);
+        settled(in);
+        if( out.empty() && in.empty() ) break;
+
+        auto out_slack {out.empty()? std::numeric_limits<int64_t>::max() : out.top().first - offset};
+        auto in_slack {in.empty()? std::numeric_limits<int64_t>::max() : in.top().first + offset};
+        if( out_slack <= in_slack )
+        {
+          auto e {out.top().second};
+          out.pop();
+          offset += out_slack;
+          tree_insert(e);
+          add(m_head[e]);
+        }
+        else
+        {
+          auto e {in.top().second};
+          in.pop();
+          offset -= in_slack;
+          tree_insert(e);
+          add(m_tail[e]);
+        } // if
+      } // while
+
+      for (auto v : members) { m_rank[static_cast<size_t>(v)] += offset; }
+    }
+
+    //
+    // Tree ranges and cut values
+    //
+
+    // Parent edges and low/lim postorder ranges of the subtree of v
+    void range(int64_t v, int64_t parent, int64_t low)
+    {
+      m_par.resize(m_rank.size());
+      m_low.resize(m_rank.size());
+      m_lim.resize(m_rank.size());
+      m_postorder.clear();
+
+      std::vector<std::pair<int64_t,size_t>> stack{{v,0}};
+      m_par[static_cast<size_t>(v)] = parent;
+      m_low[static_cast<size_t>(v)] = low;
+      auto lim {low};
+      while( ! stack.empty() )
+      {
+        auto [u,k] {stack.back()};
+        auto const& edges {m_tree_edges[static_cast<size_t>(u)]};
+        if( k == edges.size() )
+        {
+          m_lim[static_cast<size_t>(u)] = lim++;
+          m_postorder.push_back(u);
+          stack.pop_back();
+          continue;
+        } // if
+        ++stack.back().second;
+        auto e {edges[k]};
+        if( e == m_par[static_cast<size_t>(u)] ) continue;
+        auto w {other(e, u)};
+        m_par[static_cast<size_t>(w)] = e;
+        m_low[static_cast<size_t>(w)] = lim;
+        stack.emplace_back(w, 0);
+      } // while
+    }
+
+    // Contribution of e, incident to v, to the cut value of the parent edge
+    // of v, dir tells whether v is the tail of that edge
+    int64_t contribution(int64_t e, int64_t v, bool dir) const noexcept
+    {
+      bool outside {! below(other(e, v), v)};
+      auto value {outside? m_weight[static_cast<size_t>(e)]
+        : (m_tree[static_cast<size_t>(e)]? m_cut[static_cast<size_t>(e)] : 0) - m_weight[static_cast<size_t>(e)]};
+      int32_t d {dir? ((m_head[e] == v)? 1 : -1) : ((m_tail[e] == v)? 1 : -1)};
+      if( outside ) { d = -d; }
+      return (d < 0)? -value : value;
+    }
+
+    // Cut value of the parent edge of v, the edges below are known
+    void cut_value(int64_t v)
+    {
+      auto f {m_par[static_cast<size_t>(v)]};
+      bool dir {m_tail[f] == v};
+      auto const i {static_cast<size_t>(v)};
+      int64_t sum{0};
+      for (auto k{m_out[i]}; k < m_out[i+1]; ++k) { sum += contribution(m_out_edges[k], v, dir); }
+      for (auto k{m_in[i]}; k < m_in[i+1]; ++k) { sum += contribution(m_in_edges[k], v, dir); }
+      m_cut[static_cast<size_t>(f)] = sum;
+    }
+
+    void cut_values()
+    {
+      m_cut.assign(m_tail.size(), 0);
+      for (auto v : m_postorder)
+      {
+        if( m_par[static_cast<size_t>(v)] >= 0 ) { cut_value(v); }
+      } // for: v
+    }
+
+    //
+    // Pivots
+    //
+
+    // A tree edge with negative cut value, the most negative among the first
+    // few found from where the last search stopped
+    int64_t leave()
+    {
+      constexpr int32_t s_search {30};
+      int64_t best{-1};
+      int32_t found{0};
+      auto m {static_cast<int64_t>(m_tail.size())};
+      for (int64_t k{0}; k < m && found < s_search; ++k)
+      {
+        auto e {(m_search + k) % m};
+        if( ! m_tree[static_cast<size_t>(e)] || m_cut[static_cast<size_t>(e)] >= 0 ) continue;
+        if( best < 0 || m_cut[static_cast<size_t>(e)] < m_cut[static_cast<size_t>(best)] ) { best = e; }
+        ++found;
+      } // for: k
+      if( best >= 0 ) { m_search = best; }
+      return best;
+    }
+
+    // Non-tree edge of least slack that reconnects the two halves of the
+    // tree split at e, crossing in the direction opposite to e
+    int64_t enter(int64_t e) const
+    {
+      auto [t,h] {std::make_pair(m_tail[e], m_head[e])};
+      bool tail_below {m_lim[static_cast<size_t>(t)] < m_lim[static_cast<size_t>(h)]};
+      auto v {tail_below? t : h};
+
+      int64_t best{-1};
+      auto best_slack {std::numeric_limits<int64_t>::max()};
+      std::vector<int64_t> stack{v};
+      while( ! stack.empty() && best_slack > 0 )
+      {
+        auto u {stack.back()};
+        stack.pop_back();
+        auto const i {static_cast<size_t>(u)};
+
+        // Edges leaving the subtree of v against the direction of e
+        auto const& [offsets,edges] {tail_below? std::tie(m_in, m_in_edges) : std::tie(m_out, m_out_edges)};
+        for (auto k{offsets[i]}; k < offsets[i+1]; ++k)
+        {
+          auto f {edges[k]};
+          if( m_tree[static_cast<size_t>(f)] || below(other(f, u), v) ) continue;
+          if( auto s {slack(f)}; s < best_slack ) { best = f; best_slack = s; }
+        } // for: k
+
+        // Children in the tree
+        for (auto f : m_tree_edges[i])
+        {
+          if( f != m_par[i] ) { stack.push_back(other(f, u)); }
+        } // for: f
+      } // while
+
+      return best;
+    }
+
+    // Shift the ranks of the subtree of v by -delta
+    void rerank(int64_t v, int64_t delta)
+    {
+      std::vector<int64_t> stack{v};
+      while( ! stack.empty() )
+      {
+        auto u {stack.back()};
+        stack.pop_back();
+        m_rank[static_cast<size_t>(u)] -= delta;
+        for (auto f : m_tree_edges[static_cast<size_t>(u)])
+        {
+          if( f != m_par[static_cast<size_t>(u)] ) { stack.push_back(other(f, u)); }
+        } // for: f
+      } // while
+    }
+
+    // Add cutvalue to the tree edges from v up to the common ancestor with w
+    int64_t tree_update(int64_t v, int64_t w, int64_t cutvalue, bool dir)
+    {
+      while( ! below(w, v) )
+      {
+        auto e {m_par[static_cast<size_t>(v)]};
+        bool d {(v == m_tail[e])? dir : ! dir};
+        m_cut[static_cast<size_t>(e)] += d? cutvalue : -cutvalue;
+        v = (m_lim[static_cast<size_t>(m_tail[e])] > m_lim[static_cast<size_t>(m_head[e])])? m_tail[e] : m_head[e];
+      } // while
+      return v;
+    }
+
+    // Replace the tree edge e by f
+    void update(int64_t e, int64_t f)
+    {
+      // Move the subtree below e so that f becomes tight
+      if( auto delta {slack(f)}; delta > 0 )
+      {
+        auto [t,h] {std::make_pair(m_tail[e], m_head[e])};
+        if( m_lim[static_cast<size_t>(t)] < m_lim[static_cast<size_t>(h)] ) { rerank(t, delta); }
+        else { rerank(h, -delta); }
+      } // if
+
+      auto cutvalue {m_cut[static_cast<size_t>(e)]};
+      auto lca {tree_update(m_tail[f], m_head[f], cutvalue, true)};
+      tree_update(m_head[f], m_tail[f], cutvalue, false);
+      m_cut[static_cast<size_t>(f)] = -cutvalue;
+      m_cut[static_cast<size_t>(e)] = 0;
+      tree_erase(e);
+      tree_insert(f);
+      range(lca, m_par[static_cast<size_t>(lca)], m_low[static_cast<size_t>(lca)]);
+    }
+
+    std::vector<T> m_vertices{};
+    std::vector<int64_t> m_rank{};
+
+    // Edges and incidence lists
+    std::vector<int64_t> m_tail{};
+    std::vector<int64_t> m_head{};
+    std::vector<int64_t> m_weight{};
+    std::vector<size_t> m_out{};
+    std::vector<size_t> m_in{};
+    std::vector<int64_t> m_out_edges{};
+    std::vector<int64_t> m_in_edges{};
+
+    // Spanning tree
+    std::vector<bool> m_tree{};
+    std::vector<std::vector<int64_t>> m_tree_edges{};
+    std::vector<int64_t> m_cut{};
+    std::vector<int64_t> m_par{};
+    std::vector<int64_t> m_low{};
+    std::vector<int64_t> m_lim{};
+    std::vector<int64_t> m_postorder{};
+    int64_t m_search{0};
+}; // class: Network
+
+//
+// Algorithm
+//
+
+// Total span of the edges between vertices of the view, the edge count of
+// the balanced graph
+template<std::signed_integral T, depth::Function F>
+int64_t span(depth::Flat<T> const& view, F&& pred)
+{
+  int64_t total{0};
+  for (auto const& v : view.vertices())
+  {
+    for (auto&& p : pred(v))
+    {
+      if( view.level(p) >= 0 ) { total += view.level(v) - view.level(p); }
+    } // for: p
+  } // for: v
+  return total;
+} // span
+
+// Levels of the vertices of view, which must be a valid layering such as
+// depth::flat, that minimize the span within at most iterations pivots.
+// Sources stay on level 0, so this is the optimum among layerings with the
+// same sources, not the unconstrained optimum of Gansner et al.: an edge
+// from a source into a deep vertex keeps its length. With 0 -> 1 -> 2 ->
+// 3 -> 4 and 5 -> 4, vertex 5 stays on level 0 and the span stays 8.
+template<std::signed_integral T, depth::Function F>
+depth::Flat<T> simplex(depth::Flat<T> const& view, F&& pred,
+  int64_t iterations = std::numeric_limits<int64_t>::max())
+{
+  if( view.vertices().empty() ) return view;
+  Network<T> network{view, pred};
+  network.run(iterations);
+  return network.view();
+} // simplex
+
+template<std::signed_integral T, depth::Function F1, depth::Function F2>
+depth::Flat<T> simplex(T root, F1&& pred, F2&& succ,
+  int64_t iterations = std::numeric_limits<int64_t>::max())
+{
+  return simplex(depth::flat(root, pred, succ), pred, iterations);
+} // simplex
+
+} // namespace celaeno::graph::views::layering
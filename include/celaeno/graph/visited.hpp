@@ -0,0 +1,235 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : visited
+// @created     : Saturday Oct 17, 2026 03:13:55 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <concepts>
+#include <algorithm>
+#include <utility>
+
+namespace celaeno::graph::visited
+{
+
+//
+// Concepts
+//
+// Visited state of a traversal, queried and updated once per vertex.
+// std::set and std::unordered_set also satisfy it.
+template<typename V, typename T>
+concept Visited =
+  requires(V v, T t)
+  {
+    { v.contains(t) } -> std::same_as<bool>;
+    { v.insert(t) };
+    { v.clear() };
+  };
+
+//
+// Dense bitset
+//
+// One bit per vertex id, for compact ids. Negative ids (e.g. balance pseudo
+// vertices) go to a second array indexed by -v-1, so ids on both sides of
+// zero stay dense. Grows on insertion, clear() is linear on the largest
+// inserted id magnitude.
+//
+template<std::signed_integral T>
+class Bitset
+{
+  public:
+    explicit Bitset(size_t n = 0)
+      : m_words((n+63)/64, 0)
+    {}
+
+    bool contains(T v) const noexcept
+    {
+      auto const& words {(v < 0)? m_negative : m_words};
+      auto i {index(v)};
+      return (i/64 < words.size()) && (words[i/64] >> (i%64) & 1);
+    }
+
+    bool insert(T v)
+    {
+      auto& words {(v < 0)? m_negative : m_words};
+      auto i {index(v)};
+      if( i/64 >= words.size() ) { words.resize(std::max(i/64+1, words.size()*2), 0); }
+      auto mask {uint64_t{1} << (i%64)};
+      bool inserted {(words[i/64] & mask) == 0};
+      words[i/64] |= mask;
+      return inserted;
+    }
+
+    void clear() noexcept
+    {
+      std::fill(m_words.begin(), m_words.end(), 0);
+      std::fill(m_negative.begin(), m_negative.end(), 0);
+    }
+
+  private:
+    // Position on the side of zero of v, ~v is -v-1 without overflow
+    static size_t index(T v) noexcept { return static_cast<size_t>((v < 0)? ~v : v); }
+
+    std::vector<uint64_t> m_words;
+    std::vector<uint64_t> m_negative{};
+}; // class: Bitset
+
+//
+// Flat hash set
+//
+// Open addressing with linear probing, for sparse or negative ids. Keys live
+// in a single array, clear() keeps the capacity.
+//
+template<std::signed_integral T>
+class Hash
+{
+  public:
+    explicit Hash(size_t n = 0)
+      : m_keys(capacity_for(n), empty)
+    {}
+
+    bool contains(T v) const noexcept
+    {
+      if( v == empty ) return m_has_empty;
+      for (auto i {slot(v)}; ; i = (i+1) & (m_keys.size()-1))
+      {
+        if( m_keys[i] == v ) return true;
+        if( m_keys[i] == empty ) return false;
+      } // for: i
+    }
+
+    bool insert(T v)
+    {
+      if( v == empty ) { return ! std::exchange(m_has_empty, true); }
+      // Keep the load factor at or below 1/2
+      if( 2*(m_size+1) > m_keys.size() ) { rehash(m_keys.size()*2); }
+      for (auto i {slot(v)}; ; i = (i+1) & (m_keys.size()-1))
+      {
+        if( m_keys[i] == v ) return false;
+        if( m_keys[i] == empty ) { m_keys[i] = v; ++m_size; return true; }
+      } // for: i
+    }
+
+    void clear() noexcept
+    {
+      std::fill(m_keys.begin(), m_keys.end(), empty);
+      m_size = 0;
+      m_has_empty = false;
+    }
+
+  private:
+    // Marks an unused slot, the id itself is tracked by m_has_empty
+    static constexpr T empty {std::numeric_limits<T>::min()};
+
+    static size_t capacity_for(size_t n)
+    {
+      size_t c{16};
+      while( c < 2*n ) { c *= 2; }
+      return c;
+    }
+
+    // Fibonacci hashing, the capacity is a power of two
+    size_t slot(T v) const noexcept
+    {
+      auto h {static_cast<uint64_t>(v) * uint64_t{0x9E3779B97F4A7C15}};
+      return static_cast<size_t>(h >> 32) & (m_keys.size()-1);
+    }
+
+    void rehash(size_t capacity)
+    {
+      std::vector<T> keys(capacity, empty);
+      std::swap(keys, m_keys);
+      for (auto const& k : keys)
+      {
+        if( k == empty ) continue;
+        auto i {slot(k)};
+        while( m_keys[i] != empty ) { i = (i+1) & (m_keys.size()-1); }
+        m_keys[i] = k;
+      } // for: keys
+    }
+
+    std::vector<T> m_keys;
+    size_t m_size{0};
+    bool m_has_empty{false};
+}; // class: Hash
+
+//
+// Generation-stamped array
+//
+// A vertex is visited when its stamp equals the current generation, so
+// clear() only advances the generation. Meant to be kept as a workspace and
+// reused across many traversals over compact ids; negative ids are stamped
+// in a second array indexed by -v-1, as in Bitset.
+//
+template<std::signed_integral T>
+class Stamp
+{
+  public:
+    explicit Stamp(size_t n = 0)
+      : m_stamps(n, 0)
+    {}
+
+    bool contains(T v) const noexcept
+    {
+      auto const& stamps {(v < 0)? m_negative : m_stamps};
+      auto i {index(v)};
+      return i < stamps.size() && stamps[i] == m_generation;
+    }
+
+    bool insert(T v)
+    {
+      auto& stamps {(v < 0)? m_negative : m_stamps};
+      auto i {index(v)};
+      if( i >= stamps.size() ) { stamps.resize(std::max(i+1, stamps.size()*2), 0); }
+      return std::exchange(stamps[i], m_generation) != m_generation;
+    }
+
+    void clear() noexcept
+    {
+      // Stamps are only reset when the generation wraps around
+      if( ++m_generation == 0 )
+      {
+        std::fill(m_stamps.begin(), m_stamps.end(), 0);
+        std::fill(m_negative.begin(), m_negative.end(), 0);
+        m_generation = 1;
+      } // if
+    }
+
+  private:
+    static size_t index(T v) noexcept { return static_cast<size_t>((v < 0)? ~v : v); }
+
+    std::vector<uint32_t> m_stamps;
+    std::vector<uint32_t> m_negative{};
+    uint32_t m_generation{1};
+}; // class: Stamp
+
+} // namespace celaeno::graph::visited
@@ -6,18 +6,116 @@
 
 #pragma once
 
+#include <span>
+#include <tuple>
 #include <utility>
 #include <type_traits>
+#include <algorithm>
 #include <cmath>
+#include <cassert>
 #include <cstdint>
 
 namespace celaeno::math::cantor_pairing
 {
 
+//
+// Aliases
+//
+__extension__ typedef unsigned __int128 uint128_t;
+
+//
+// Exact kernels
+//
+
+// w(w+1)/2 without overflow in the intermediate product
+constexpr uint128_t triangular(uint64_t w) noexcept
+{
+  return (uint128_t{w} * (uint128_t{w} + 1)) >> 1;
+}
+
+// Largest w such that w(w+1)/2 <= z
+constexpr uint64_t triangular_root(uint64_t z) noexcept
+{
+  uint64_t w{0};
+
+  if( std::is_constant_evaluated() )
+  {
+    // The root of a 64 bit value is below 2^33
+    for (uint64_t bit{uint64_t{1} << 32}; bit != 0; bit >>= 1)
+    {
+      if( triangular(w | bit) <= z ) { w |= bit; }
+    } // for: bit
+    return w;
+  } // if
+
+  // 8z+1 loses its low bits as a double, which moves the root by less than
+  // one; the loops below settle the exact w
+  w = static_cast<uint64_t>((std::sqrt(8. * static_cast<double>(z) + 1.) - 1.) / 2.);
+  while( w > 0 && triangular(w) > z ) { --w; }
+  while( triangular(w+1) <= z ) { ++w; }
+  return w;
+}
+
+// Largest sum k1+k2 with a 64 bit key, reached by unpair(2^64-1)
+constexpr uint64_t max_sum {6074000999};
+
+// Whether pair(k1,k2) fits in 64 bits, i.e., triangular(k1+k2) + k2 does,
+// without overflowing k1+k2 itself
+constexpr bool fits(uint64_t k1, uint64_t k2) noexcept
+{
+  return k1 <= max_sum && k2 <= max_sum - k1
+    && triangular(k1+k2) + k2 <= uint128_t{UINT64_MAX};
+}
+
+// Exact for fits(k1,k2), the product wraps past it
+constexpr uint64_t pair(uint64_t k1, uint64_t k2) noexcept
+{
+  assert(fits(k1,k2));
+  // Halve the even factor first, the product is then the result itself
+  auto s {k1+k2};
+  auto odd {(s & 1) != 0};
+  return (odd? s : s >> 1) * (odd? (s+1) >> 1 : s+1) + k2;
+}
+
+constexpr std::pair<uint64_t,uint64_t> unpair(uint64_t z) noexcept
+{
+  auto w {triangular_root(z)};
+  auto k2 {z - static_cast<uint64_t>(triangular(w))};
+  return {w - k2, k2};
+}
+
+//
+// Batched kernels
+//
+
+// z[i] = pair(k1[i], k2[i]) over the shortest of the spans, each pair must
+// satisfy fits
+inline void pair(std::span<uint64_t const> k1, std::span<uint64_t const> k2, std::span<uint64_t> z) noexcept
+{
+  auto n {std::min({k1.size(), k2.size(), z.size()})};
+  // The parity select becomes a conditional move, elements are independent
+  for (size_t i{0}; i < n; ++i) { z[i] = pair(k1[i], k2[i]); }
+}
+
+// (k1[i], k2[i]) = unpair(z[i]) over the shortest of the spans
+inline void unpair(std::span<uint64_t const> z, std::span<uint64_t> k1, std::span<uint64_t> k2) noexcept
+{
+  auto n {std::min({z.size(), k1.size(), k2.size()})};
+  for (size_t i{0}; i < n; ++i) { std::tie(k1[i], k2[i]) = unpair(z[i]); }
+}
+
+//
+// Algorithm
+//
+
+// Floating point interface, results are doubles whatever the input type.
+// Non-negative integers go through the exact kernels and are only rounded on
+// the way out; negative ones, and pairs whose key does not fit in 64 bits,
+// keep the closed form. Use pair and unpair for exact integer results.
 template<typename T>
 auto cantor_pairing(T&& z)
 {
-  using _T = std::remove_reference_t<T>;
+  using _T = std::remove_cvref_t<T>;
   using float32_t = float;
   using float64_t = double;
 
@@ -29,6 +127,14 @@ auto cantor_pairing(T&& z)
       std::is_same_v<_T, float64_t>
     )
   {
+    if constexpr ( std::is_integral_v<_T> )
+    {
+      if( z >= 0 )
+      {
+        auto [k1,k2] {unpair(static_cast<uint64_t>(z))};
+        return std::make_pair(static_cast<float64_t>(k1), static_cast<float64_t>(k2));
+      } // if
+    } // if
     auto w { std::floor( ( -1 + std::sqrt( 8 * z + 1 ) ) / 2 ) };
     auto t { ( std::pow(w,2) + w ) / 2 };
     auto k2 { z - t };
@@ -39,9 +145,16 @@ auto cantor_pairing(T&& z)
   {
     auto const& k1 {z.first};
     auto const& k2 {z.second};
+    using K = std::remove_cvref_t<decltype(k1)>;
+    if constexpr ( std::is_integral_v<K> )
+    {
+      if( k1 >= 0 && k2 >= 0 && fits(static_cast<uint64_t>(k1), static_cast<uint64_t>(k2)) )
+      {
+        return static_cast<float64_t>(pair(static_cast<uint64_t>(k1), static_cast<uint64_t>(k2)));
+      } // if
+    } // if
     return .5 * (k1 + k2) * (k1 + k2 + 1) + k2;
   }
 }
 
 } // namespace celaeno::math::cantor_pairing
-
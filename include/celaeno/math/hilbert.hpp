@@ -0,0 +1,64 @@
+/**
+ * @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+ * @file        : hilbert
+ * @created     : Saturday Oct 17, 2026 03:54:56 -03
+ */
+
+#pragma once
+
+#include <utility>
+#include <cstdint>
+
+namespace celaeno::math::hilbert
+{
+
+//
+// Exact kernels
+//
+
+// Reflect and transpose the quadrant so the sub-curve has the base orientation
+constexpr void rotate(uint64_t n, uint64_t& x, uint64_t& y, uint64_t rx, uint64_t ry) noexcept
+{
+  if( ry != 0 ) return;
+  if( rx != 0 )
+  {
+    x = n-1 - x;
+    y = n-1 - y;
+  } // if
+  std::swap(x,y);
+}
+
+// Position of (x,y) along the Hilbert curve that fills the 2^order square,
+// order <= 32
+constexpr uint64_t encode(uint32_t x, uint32_t y, uint32_t order) noexcept
+{
+  uint64_t n {uint64_t{1} << order};
+  uint64_t a{x}, b{y}, d{0};
+  for (uint64_t s{n >> 1}; s > 0; s >>= 1)
+  {
+    uint64_t rx {(a & s) != 0};
+    uint64_t ry {(b & s) != 0};
+    d += s * s * ((3 * rx) ^ ry);
+    rotate(n, a, b, rx, ry);
+  } // for: s
+  return d;
+}
+
+// Cell at position d of the Hilbert curve of the 2^order square
+constexpr std::pair<uint32_t,uint32_t> decode(uint64_t d, uint32_t order) noexcept
+{
+  uint64_t n {uint64_t{1} << order};
+  uint64_t x{0}, y{0};
+  for (uint64_t s{1}; s < n; s <<= 1)
+  {
+    uint64_t rx {1 & (d >> 1)};
+    uint64_t ry {1 & (d ^ rx)};
+    rotate(s, x, y, rx, ry);
+    x += s * rx;
+    y += s * ry;
+    d >>= 2;
+  } // for: s
+  return {static_cast<uint32_t>(x), static_cast<uint32_t>(y)};
+}
+
+} // namespace celaeno::math::hilbert
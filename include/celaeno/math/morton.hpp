@@ -0,0 +1,78 @@
+/**
+ * @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+ * @file        : morton
+ * @created     : Saturday Oct 17, 2026 03:47:39 -03
+ */
+
+#pragma once
+
+#include <span>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+
+namespace celaeno::math::morton
+{
+
+//
+// Exact kernels
+//
+
+// Insert a zero bit above each bit of x
+constexpr uint64_t spread(uint32_t x) noexcept
+{
+  uint64_t v{x};
+  v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+  v = (v | (v << 8))  & 0x00FF00FF00FF00FFull;
+  v = (v | (v << 4))  & 0x0F0F0F0F0F0F0F0Full;
+  v = (v | (v << 2))  & 0x3333333333333333ull;
+  v = (v | (v << 1))  & 0x5555555555555555ull;
+  return v;
+}
+
+// Gather the even bits of v, inverse of spread
+constexpr uint32_t compact(uint64_t v) noexcept
+{
+  v &= 0x5555555555555555ull;
+  v = (v | (v >> 1))  & 0x3333333333333333ull;
+  v = (v | (v >> 2))  & 0x0F0F0F0F0F0F0F0Full;
+  v = (v | (v >> 4))  & 0x00FF00FF00FF00FFull;
+  v = (v | (v >> 8))  & 0x0000FFFF0000FFFFull;
+  v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+  return static_cast<uint32_t>(v);
+}
+
+// Z-order key, x on the even bits and y on the odd bits
+constexpr uint64_t encode(uint32_t x, uint32_t y) noexcept
+{
+  return spread(x) | (spread(y) << 1);
+}
+
+constexpr std::pair<uint32_t,uint32_t> decode(uint64_t z) noexcept
+{
+  return {compact(z), compact(z >> 1)};
+}
+
+//
+// Batched kernels
+//
+
+// z[i] = encode(x[i], y[i]) over the shortest of the spans
+inline void encode(std::span<uint32_t const> x, std::span<uint32_t const> y, std::span<uint64_t> z) noexcept
+{
+  auto n {std::min({x.size(), y.size(), z.size()})};
+  for (size_t i{0}; i < n; ++i) { z[i] = encode(x[i], y[i]); }
+}
+
+// (x[i], y[i]) = decode(z[i]) over the shortest of the spans
+inline void decode(std::span<uint64_t const> z, std::span<uint32_t> x, std::span<uint32_t> y) noexcept
+{
+  auto n {std::min({z.size(), x.size(), y.size()})};
+  for (size_t i{0}; i < n; ++i)
+  {
+    x[i] = compact(z[i]);
+    y[i] = compact(z[i] >> 1);
+  } // for: i
+}
+
+} // namespace celaeno::math::morton
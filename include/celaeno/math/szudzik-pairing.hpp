@@ -0,0 +1,80 @@
+/**
+ * @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+ * @file        : szudzik-pairing
+ * @created     : Saturday Oct 17, 2026 03:47:01 -03
+ */
+
+#pragma once
+
+#include <span>
+#include <tuple>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <cstdint>
+
+namespace celaeno::math::szudzik_pairing
+{
+
+//
+// Exact kernels
+//
+
+// Largest s such that s*s <= z
+constexpr uint64_t isqrt(uint64_t z) noexcept
+{
+  uint64_t s{0};
+
+  if( std::is_constant_evaluated() )
+  {
+    for (uint64_t bit{uint64_t{1} << 31}; bit != 0; bit >>= 1)
+    {
+      if( (s | bit) * (s | bit) <= z ) { s |= bit; }
+    } // for: bit
+    return s;
+  } // if
+
+  // A correctly rounded sqrt of z truncates to within one of s; the clamp
+  // keeps (s+1)^2 from wrapping, as (2^32)^2 does not fit
+  s = std::min(static_cast<uint64_t>(std::sqrt(static_cast<double>(z))), uint64_t{0xFFFFFFFF});
+  while( s * s > z ) { --s; }
+  while( s < 0xFFFFFFFF && (s+1) * (s+1) <= z ) { ++s; }
+  return s;
+}
+
+// Every pair of 32 bit values maps into 64 bits, the largest to 2^64-1
+constexpr uint64_t pair(uint32_t x, uint32_t y) noexcept
+{
+  uint64_t a{x}, b{y};
+  return (a < b)? b*b + a : a*a + a + b;
+}
+
+constexpr std::pair<uint32_t,uint32_t> unpair(uint64_t z) noexcept
+{
+  auto s {isqrt(z)};
+  auto l {z - s*s};
+  return (l < s)? std::make_pair(static_cast<uint32_t>(l), static_cast<uint32_t>(s))
+    : std::make_pair(static_cast<uint32_t>(s), static_cast<uint32_t>(l-s));
+}
+
+//
+// Batched kernels
+//
+
+// z[i] = pair(x[i], y[i]) over the shortest of the spans
+inline void pair(std::span<uint32_t const> x, std::span<uint32_t const> y, std::span<uint64_t> z) noexcept
+{
+  auto n {std::min({x.size(), y.size(), z.size()})};
+  // The shell comparison in pair lowers to a select, the loop has no branches
+  for (size_t i{0}; i < n; ++i) { z[i] = pair(x[i], y[i]); }
+}
+
+// (x[i], y[i]) = unpair(z[i]) over the shortest of the spans
+inline void unpair(std::span<uint64_t const> z, std::span<uint32_t> x, std::span<uint32_t> y) noexcept
+{
+  auto n {std::min({z.size(), x.size(), y.size()})};
+  for (size_t i{0}; i < n; ++i) { std::tie(x[i], y[i]) = unpair(z[i]); }
+}
+
+} // namespace celaeno::math::szudzik_pairing
@@ -0,0 +1,255 @@
+/**
+ * @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+ * @file        : tiled
+ * @created     : Saturday Oct 17, 2026 03:58:37 -03
+ */
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <unordered_map>
+#include <functional>
+#include <cstdint>
+#include <celaeno/math/morton.hpp>
+#include <celaeno/math/hilbert.hpp>
+
+namespace celaeno::math::tiled
+{
+
+//
+// Aliases
+//
+__extension__ typedef unsigned __int128 uint128_t;
+
+//
+// Tile
+//
+
+enum class Curve
+{
+  morton,
+  hilbert,
+};
+
+// Square block of 2^log x 2^log cells laid out along a space-filling curve,
+// so the cells around any cell of the tile sit in nearby slots. The offset of
+// each cell inside the tile and its inverse are tabulated.
+class Tile
+{
+  public:
+    explicit Tile(Curve curve = Curve::hilbert, int32_t log = 3)
+      : m_log{std::clamp(log, 0, 8)}
+      , m_offset(size_t{1} << (2*m_log))
+      , m_local(m_offset.size())
+    {
+      auto side {uint32_t{1} << m_log};
+      for (uint32_t r{0}; r < side; ++r)
+      {
+        for (uint32_t c{0}; c < side; ++c)
+        {
+          auto offset {(curve == Curve::morton)? morton::encode(c,r)
+            : hilbert::encode(c,r,static_cast<uint32_t>(m_log))};
+          auto local {(r << m_log) | c};
+          m_offset[local] = static_cast<uint16_t>(offset);
+          m_local[offset] = static_cast<uint16_t>(local);
+        } // for: c
+      } // for: r
+    }
+
+    int32_t log() const noexcept { return m_log; }
+    int64_t mask() const noexcept { return (int64_t{1} << m_log) - 1; }
+    int64_t cells() const noexcept { return static_cast<int64_t>(m_offset.size()); }
+
+    // Slot inside the tile of the cell at row r and column c of the tile
+    int64_t offset(int64_t r, int64_t c) const noexcept
+    {
+      return m_offset[static_cast<size_t>((r << m_log) | c)];
+    }
+
+    // Row and column inside the tile of slot o
+    std::pair<int64_t,int64_t> local(int64_t o) const noexcept
+    {
+      auto l {m_local[static_cast<size_t>(o)]};
+      return {l >> m_log, l & mask()};
+    }
+
+  private:
+    int32_t m_log;
+    std::vector<uint16_t> m_offset;
+    std::vector<uint16_t> m_local;
+}; // class: Tile
+
+//
+// Layout
+//
+
+// Numbering of the cells of an inclusive rectangle, first as the row and
+// second as the column. The rectangle is cut into tiles stored one after the
+// other in row-major order, each holding its cells along the curve; the last
+// row and column of tiles are padded, so size() counts the padding slots and
+// cell() of a padding slot falls outside the rectangle. Drop-in replacement
+// for a_star::Bounds.
+class Layout
+{
+  public:
+    Layout(std::pair<int64_t,int64_t> min, std::pair<int64_t,int64_t> max,
+      Curve curve = Curve::hilbert, int32_t log = 3)
+      : m_min{min}
+      , m_max{max}
+      , m_tile{curve, log}
+      , m_tile_cols{(cols() + m_tile.mask()) >> m_tile.log()}
+      , m_tile_rows{(rows() + m_tile.mask()) >> m_tile.log()}
+    {}
+
+    std::pair<int64_t,int64_t> const& min() const noexcept { return m_min; }
+    std::pair<int64_t,int64_t> const& max() const noexcept { return m_max; }
+    int64_t rows() const noexcept { return m_max.first - m_min.first + 1; }
+    int64_t cols() const noexcept { return m_max.second - m_min.second + 1; }
+    size_t size() const noexcept { return static_cast<size_t>(m_tile_rows * m_tile_cols * m_tile.cells()); }
+
+    template<typename P>
+    bool contains(P const& p) const noexcept
+    {
+      return p.first >= m_min.first && p.first <= m_max.first
+        && p.second >= m_min.second && p.second <= m_max.second;
+    }
+
+    template<typename P>
+    int64_t index(P const& p) const noexcept
+    {
+      auto r {p.first - m_min.first};
+      auto c {p.second - m_min.second};
+      auto tile {(r >> m_tile.log()) * m_tile_cols + (c >> m_tile.log())};
+      return (tile << (2*m_tile.log())) | m_tile.offset(r & m_tile.mask(), c & m_tile.mask());
+    }
+
+    std::pair<int64_t,int64_t> cell(int64_t i) const noexcept
+    {
+      auto tile {i >> (2*m_tile.log())};
+      auto [r,c] {m_tile.local(i & (m_tile.cells()-1))};
+      return {m_min.first + ((tile / m_tile_cols) << m_tile.log()) + r,
+        m_min.second + ((tile % m_tile_cols) << m_tile.log()) + c};
+    }
+
+  private:
+    std::pair<int64_t,int64_t> m_min;
+    std::pair<int64_t,int64_t> m_max;
+    Tile m_tile;
+    int64_t m_tile_cols;
+    int64_t m_tile_rows;
+}; // class: Layout
+
+//
+// Stores
+//
+
+// Dense array with one value per slot of a layout
+template<typename T>
+class Store
+{
+  public:
+    explicit Store(Layout layout, T const& value = T{})
+      : m_layout{std::move(layout)}
+      , m_values(m_layout.size(), value)
+    {}
+
+    Layout const& layout() const noexcept { return m_layout; }
+
+    template<typename P>
+    T& operator[](P const& p) noexcept { return m_values[static_cast<size_t>(m_layout.index(p))]; }
+    template<typename P>
+    T const& operator[](P const& p) const noexcept { return m_values[static_cast<size_t>(m_layout.index(p))]; }
+
+    void fill(T const& value) { std::ranges::fill(m_values, value); }
+
+  private:
+    Layout m_layout;
+    std::vector<T> m_values;
+}; // class: Store
+
+// Unbounded grid of values, allocated one tile at a time and found through
+// a hash of the 128 bit Morton key of the tile coordinates, so every pair of
+// int64_t coordinates gets its own tile. The last tile used is
+// cached, since consecutive accesses mostly stay within a tile.
+template<typename T>
+class Sparse
+{
+  public:
+    explicit Sparse(Curve curve = Curve::hilbert, int32_t log = 3, T const& value = T{})
+      : m_tile{curve, log}
+      , m_value{value}
+    {}
+
+    Sparse(Sparse const&) = delete;
+    Sparse& operator=(Sparse const&) = delete;
+
+    // Value of p, nullptr if its tile was never allocated
+    template<typename P>
+    T const* find(P const& p) const
+    {
+      auto it {m_tiles.find(key(p))};
+      return (it == m_tiles.end())? nullptr : &it->second[offset(p)];
+    }
+
+    // Value of p, allocating its tile when needed
+    template<typename P>
+    T& operator[](P const& p)
+    {
+      auto k {key(p)};
+      if( m_last == nullptr || k != m_last_key )
+      {
+        auto [it,inserted] {m_tiles.try_emplace(k)};
+        if( inserted ) { it->second.assign(static_cast<size_t>(m_tile.cells()), m_value); }
+        m_last = &it->second;
+        m_last_key = k;
+      } // if
+      return (*m_last)[offset(p)];
+    }
+
+    size_t tiles() const noexcept { return m_tiles.size(); }
+
+    void clear()
+    {
+      m_tiles.clear();
+      m_last = nullptr;
+    }
+
+  private:
+    // Interleave signed tile coordinates folded onto the naturals, one
+    // 32 bit half at a time
+    template<typename P>
+    uint128_t key(P const& p) const noexcept
+    {
+      auto fold = [](int64_t v){ return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); };
+      auto [x,y] {std::make_pair(fold(p.second >> m_tile.log()), fold(p.first >> m_tile.log()))};
+      auto high {morton::encode(static_cast<uint32_t>(x >> 32), static_cast<uint32_t>(y >> 32))};
+      auto low {morton::encode(static_cast<uint32_t>(x), static_cast<uint32_t>(y))};
+      return (uint128_t{high} << 64) | low;
+    }
+
+    // Nearby tiles differ in the low half, far apart ones in both
+    struct Hash
+    {
+      size_t operator()(uint128_t k) const noexcept
+      {
+        auto high {static_cast<uint64_t>(k >> 64)};
+        return std::hash<uint64_t>{}(static_cast<uint64_t>(k) ^ (high * 0x9e3779b97f4a7c15));
+      }
+    }; // struct: Hash
+
+    template<typename P>
+    size_t offset(P const& p) const noexcept
+    {
+      return static_cast<size_t>(m_tile.offset(p.first & m_tile.mask(), p.second & m_tile.mask()));
+    }
+
+    Tile m_tile;
+    T m_value;
+    std::unordered_map<uint128_t,std::vector<T>,Hash> m_tiles{};
+    std::vector<T>* m_last{nullptr};
+    uint128_t m_last_key{0};
+}; // class: Sparse
+
+} // namespace celaeno::math::tiled
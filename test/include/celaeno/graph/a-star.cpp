@@ -34,6 +34,7 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 #include <celaeno/graph/a-star.hpp>
+#include <celaeno/math/tiled.hpp>
 #include <taygete/graph/graph.hpp>
 #include <taygete/graph/reader.hpp>
 
@@ -95,6 +96,44 @@ decltype(auto) path(T1&& p1, T2&& p2) noexcept
     );
 }
 
+// Length of the shortest path between two cells of the six-neighbour
+// grid used by path
+template<typename T1, typename T2>
+int64_t hex(T1&& p1, T2&& p2) noexcept
+{
+  auto [dx,dy] {std::make_pair(p2.first - p1.first, p2.second - p1.second)};
+  return ((dx < 0) == (dy < 0))? std::max(std::abs(dx),std::abs(dy)) : std::abs(dx)+std::abs(dy);
+}
+
+template<typename G, typename T1, typename T2, typename F, typename... C>
+decltype(auto) bounded(G const& bounds, T1&& p1, T2&& p2, F&& blocked, C&... ctx) noexcept
+{
+  auto neighbors = [&blocked](auto&& pair)
+  {
+    std::vector<std::pair<int64_t,int64_t>> n
+      {
+        {pair.first+1,pair.second},
+        {pair.first-1,pair.second},
+        {pair.first,pair.second+1},
+        {pair.first,pair.second-1},
+        {pair.first-1,pair.second-1},
+        {pair.first+1,pair.second+1},
+      };
+    std::erase_if(n, blocked);
+    return n;
+  };
+
+  return a_star::a_star(
+      bounds,
+      std::forward<T1>(p1),
+      std::forward<T2>(p2),
+      neighbors,
+      [](auto&&) -> int32_t { return 1; },
+      [&](auto&& p) -> float64_t { return hex(p, p2); },
+      ctx...
+    );
+}
+
 //
 // Tests
 //
@@ -171,6 +210,178 @@ TEST_CASE("celaeno::graph::a_star")
 
   } // SUB_CASE: Path size checks
 
+  SUBCASE("Bounded grid")
+  {
+    a_star::Bounds bounds{{-100,-100},{100,100}};
+    auto none = [](auto&&){ return false; };
+
+    auto check = [&bounds](auto&& p1, auto&& p2, auto&& res)
+    {
+      REQUIRE(res.front() == p1);
+      REQUIRE(res.back() == p2);
+      for (size_t i{1}; i < res.size(); ++i)
+      {
+        REQUIRE(bounds.contains(res.at(i)));
+        REQUIRE(hex(res.at(i-1),res.at(i)) == 1);
+      } // for: i
+    };
+
+    // Shortest paths on the open grid
+    for (auto&& [x,y] : mxy)
+    {
+      auto res {bounded(bounds,x,y,none)};
+      check(x,y,res);
+      CHECK(static_cast<int64_t>(res.size()) == hex(x,y)+1);
+    } // for xy
+
+    // A wall along the first column with a single gap forces a detour
+    auto wall = [](auto&& p){ return p.second == 0 && p.first != 50; };
+    std::pair<int64_t,int64_t> p1{0,-10}, p2{0,10};
+    auto res {bounded(bounds,p1,p2,wall)};
+    check(p1,p2,res);
+    CHECK(static_cast<int64_t>(res.size()) > hex(p1,p2)+1);
+    CHECK(rg::find(res, std::make_pair(int64_t{50},int64_t{0})) != res.end());
+
+    // Closing the gap leaves no path, cells outside the bounds are
+    // never explored
+    auto closed = [](auto&& p){ return p.second == 0; };
+    CHECK(bounded(bounds,p1,p2,closed).empty());
+    CHECK(bounded(bounds,p1,std::make_pair(int64_t{0},int64_t{101}),none).empty());
+
+  } // SUB_CASE: Bounded grid
+
+  SUBCASE("Reused search context")
+  {
+    a_star::SearchContext ctx;
+    auto none = [](auto&&){ return false; };
+    auto wall = [](auto&& p){ return p.second == 0 && p.first != 50; };
+
+    // Bounded searches of growing and shrinking grids share the arrays
+    for (int64_t size : {10, 100, 20, 100})
+    {
+      a_star::Bounds bounds{{-size,-size},{size,size}};
+      for (auto&& [x,y] : mxy)
+      {
+        if( ! bounds.contains(x) || ! bounds.contains(y) ) continue;
+        CHECK(bounded(bounds,x,y,none,ctx) == bounded(bounds,x,y,none));
+        CHECK(bounded(bounds,x,y,wall,ctx) == bounded(bounds,x,y,wall));
+      } // for xy
+    } // for: size
+
+    // Unbounded searches share the tree containers
+    auto neighbors = [](auto&& pair) -> std::array<std::pair<int64_t,int64_t>,4>
+    {
+      return {{ {pair.first+1,pair.second}, {pair.first-1,pair.second},
+        {pair.first,pair.second+1}, {pair.first,pair.second-1} }};
+    };
+    for (auto&& [x,y] : pxy)
+    {
+      if( x.first % 10 != 0 ) continue;
+      auto h = [&y](auto&& p) -> float64_t { return manhattan(p, y); };
+      auto d = [](auto&&) -> int32_t { return 1; };
+      auto expected {a_star::a_star(x, y, neighbors, d, h)};
+      auto res {a_star::a_star(x, y, neighbors, d, h, ctx)};
+      REQUIRE(res.size() == expected.size());
+      for (size_t i{0}; i < res.size(); ++i) { CHECK(res.at(i) == expected.at(i)); }
+    } // for xy
+
+  } // SUB_CASE: Reused search context
+
+  SUBCASE("Bidirectional search")
+  {
+    // Walls with scattered gaps and uneven cell costs
+    a_star::Bounds bounds{{0,0},{199,199}};
+    auto blocked = [](auto&& p)
+      { return (p.second % 20 == 10 && p.first % 50 != 3) || (p.first % 30 == 15 && p.second % 40 != 7); };
+    size_t expansions{0};
+    auto neighbors = [&](auto&& pair)
+    {
+      ++expansions;
+      std::vector<std::pair<int64_t,int64_t>> n
+        { {pair.first+1,pair.second}, {pair.first-1,pair.second},
+          {pair.first,pair.second+1}, {pair.first,pair.second-1} };
+      std::erase_if(n, blocked);
+      return n;
+    };
+    auto distance = [](auto&& n) -> float64_t { return 1 + (n.first*7 + n.second*13) % 3; };
+    auto heuristic = [](auto&& a, auto&& b) -> float64_t { return manhattan(a,b); };
+    auto cost = [&](auto&& res)
+    {
+      float64_t c{0};
+      for (size_t i{1}; i < res.size(); ++i)
+      {
+        REQUIRE(manhattan(res.at(i-1),res.at(i)) == 1);
+        REQUIRE(! blocked(res.at(i)));
+        c += distance(res.at(i));
+      } // for: i
+      return c;
+    };
+
+    a_star::SearchContext forward, backward;
+    size_t uni{0}, bi{0};
+    for (auto&& [x,y] : pxy)
+    {
+      if( blocked(x) || blocked(y) ) continue;
+      auto h = [&y](auto&& p) -> float64_t { return manhattan(p, y); };
+
+      expansions = 0;
+      auto expected {a_star::a_star(bounds, x, y, neighbors, distance, h)};
+      uni += expansions;
+
+      expansions = 0;
+      auto res {a_star::bidirectional(bounds, x, y, neighbors, distance, heuristic, forward, backward)};
+      bi += expansions;
+
+      REQUIRE(res.empty() == expected.empty());
+      if( res.empty() ) continue;
+      REQUIRE(res.front() == x);
+      REQUIRE(res.back() == y);
+      CHECK(cost(res) == cost(expected));
+      REQUIRE(res == a_star::bidirectional(bounds, x, y, neighbors, distance, heuristic));
+    } // for xy
+
+    // Meeting in the middle explores fewer cells on long routes
+    CHECK(bi < uni);
+
+    // Same cell and unreachable targets
+    std::pair<int64_t,int64_t> p{4,4};
+    CHECK(a_star::bidirectional(bounds, p, p, neighbors, distance, heuristic).size() == 1);
+    auto closed = [](auto&&){ return std::vector<std::pair<int64_t,int64_t>>{}; };
+    CHECK(a_star::bidirectional(bounds, p, std::make_pair(int64_t{9},int64_t{9}), closed, distance, heuristic).empty());
+  } // SUB_CASE: Bidirectional search
+
+  SUBCASE("Tiled layout")
+  {
+    namespace tiled = celaeno::math::tiled;
+    a_star::Bounds bounds{{-37,-50},{61,45}};
+    auto wall = [](auto&& p){ return p.second == 0 && p.first != 50; };
+    a_star::SearchContext ctx;
+
+    // Same path lengths as the row-major numbering, in any tile shape
+    for (auto curve : {tiled::Curve::hilbert, tiled::Curve::morton})
+    {
+      for (int32_t log : {0, 2, 3, 5})
+      {
+        tiled::Layout layout{bounds.min, bounds.max, curve, log};
+        for (auto&& [x,y] : mxy)
+        {
+          if( ! bounds.contains(x) || ! bounds.contains(y) || wall(x) || wall(y) ) continue;
+          auto expected {bounded(bounds,x,y,wall)};
+          auto res {bounded(layout,x,y,wall,ctx)};
+          REQUIRE(res.size() == expected.size());
+          if( res.empty() ) continue;
+          CHECK(res.front() == x);
+          CHECK(res.back() == y);
+          for (size_t i{1}; i < res.size(); ++i)
+          {
+            CHECK(! wall(res.at(i)));
+            CHECK(hex(res.at(i-1),res.at(i)) == 1);
+          } // for: i
+        } // for xy
+      } // for: log
+    } // for: curve
+  } // SUB_CASE: Tiled layout
+
 } // TEST_CASE: celaeno::graph::a_star
 
 } // namespace celaeno::graph::bfs::test
@@ -33,12 +33,18 @@
 #include <doctest/doctest.h>
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <set>
+#include <random>
+#include <algorithm>
+#include <tuple>
 #include <cstdlib>
+#include <stdexcept>
 #include <concepts>
 #include <chrono>
 #include <range/v3/all.hpp>
 #include <celaeno/graph/balance.hpp>
 #include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/csr.hpp>
 #include <taygete/graph/graph.hpp>
 #include <taygete/graph/reader.hpp>
 #include <maia/circuits/iscas.hpp>
@@ -54,6 +60,7 @@ namespace graph = taygete::graph;
 namespace cir = maia::circuits;
 namespace balance = celaeno::graph::balance;
 namespace depth = celaeno::graph::views::depth;
+namespace csr = celaeno::graph::csr;
 namespace rg = ranges;
 namespace rv = ranges::views;
 namespace ra = ranges::actions;
@@ -82,12 +89,30 @@ void TEST(T&& str)
 
   auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
   auto succ = [&g](auto&& v){ return g.get_successors(v); };
-  auto link = [&g](auto&& pair){ g.emplace(pair); };
-  auto unlink = [&g](auto&& pair){ g.erase(pair); };
+  std::vector<std::pair<int64_t,int64_t>> links, unlinks;
+  auto link = [&](auto&& pair){ links.push_back(pair); g.emplace(pair); };
+  auto unlink = [&](auto&& pair){ unlinks.push_back(pair); g.erase(pair); };
+
+  // The edit plan of the unchanged graph
+  auto plan {balance::plan(int64_t{0},pred,succ)};
+  std::vector<std::pair<int64_t,int64_t>> planned_links, planned_unlinks;
+  balance::apply(plan,
+    [&](auto&& pair){ planned_links.push_back(pair); },
+    [&](auto&& pair){ planned_unlinks.push_back(pair); });
+
+  // Sharing the chains of each source never needs more pseudo vertices
+  auto shared {balance::plan(int64_t{0},pred,succ,balance::Sharing::fanout)};
+  REQUIRE(shared.chains.size() == plan.chains.size());
+  REQUIRE(shared.pseudo() <= plan.pseudo());
 
   // Execution
   balance::balance(0,pred,succ,link,unlink);
 
+  // Applying the plan makes the same edits
+  REQUIRE(links == planned_links);
+  REQUIRE(unlinks == planned_unlinks);
+  REQUIRE(static_cast<int64_t>(unlinks.size()) == plan.pseudo());
+
   //
   // Verification
   //
@@ -192,4 +217,169 @@ TEST_CASE("celaeno::graph::balance"
 
 } // TEST_CASE: celaeno::graph::balance
 
+TEST_CASE("celaeno::graph::balance::plan")
+{
+  //
+  // 0 -> 1 -> 2 -> 3 -> 4
+  // |    |         ^
+  // |    \_________|
+  // \______________/ (0 -> 4)
+  //
+  std::vector<std::pair<int64_t,int64_t>> edges {{0,1},{1,2},{2,3},{3,4},{1,3},{0,4}};
+  csr::Graph<int64_t> g{edges};
+  auto pred = [&g](auto&& v){ return g.pred(v); };
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+
+  auto plan {balance::plan(int64_t{0},pred,succ)};
+  REQUIRE(plan.counter == 0);
+  REQUIRE(plan.chains.size() == 2);
+  CHECK(plan.pseudo() == 4);
+  CHECK(plan.min() == -4);
+
+  // Rebuild the balanced graph at once, pseudo ids shifted past zero
+  auto balanced {balance::expand(plan, edges)};
+  CHECK(balanced.size() == edges.size() + static_cast<size_t>(plan.pseudo()));
+  for (auto& [u,v] : balanced) { u -= plan.min(); v -= plan.min(); }
+  csr::Graph<int64_t> h{balanced};
+  auto view {depth::flat(-plan.min(),
+    [&h](auto&& v){ return h.pred(v); },
+    [&h](auto&& v){ return h.succ(v); })};
+
+  CHECK(view.height() == 5);
+  for (auto const& [u,v] : balanced) { CHECK(view.level(v) - view.level(u) == 1); }
+
+  // Ids drawn from a range past the graph need no shift
+  balance::Range<int64_t> ids{5, 5+plan.pseudo()};
+  auto direct {balance::expand(plan, edges, ids)};
+  CHECK(ids.size() == 0);
+  csr::Graph<int64_t> k{direct};
+  CHECK(k.size() == 5 + static_cast<size_t>(plan.pseudo()));
+  auto ranged {depth::flat(int64_t{0},
+    [&k](auto&& v){ return k.pred(v); },
+    [&k](auto&& v){ return k.succ(v); })};
+  CHECK(ranged.min() == 0);
+  for (auto const& [u,v] : direct) { CHECK(ranged.level(v) - ranged.level(u) == 1); }
+
+  // balance draws from the same kind of pool, continuing where it stopped
+  std::vector<std::pair<int64_t,int64_t>> links;
+  balance::Range<int64_t> pool{100, 200};
+  balance::balance(int64_t{0}, pred, succ,
+    [&](auto&& e){ links.push_back(e); }, [](auto&&){}, pool);
+  CHECK(pool.size() == 100 - static_cast<size_t>(plan.pseudo()));
+  CHECK(pool() == 100 + plan.pseudo());
+  CHECK(std::ranges::all_of(links, [](auto&& e){ return e.first >= 100 || e.second >= 100; }));
+
+  // A range shorter than the plan is rejected before any edit
+  balance::Range<int64_t> few{10, 11};
+  size_t edits{0};
+  auto count = [&edits](auto&&){ ++edits; };
+  CHECK_THROWS_AS(balance::apply(plan, few, count, count), std::out_of_range);
+  CHECK_THROWS_AS(balance::expand(plan, edges, few), std::out_of_range);
+  CHECK_THROWS_AS(balance::parallel_expand(plan, edges, few, 2), std::out_of_range);
+  CHECK_THROWS_AS(balance::balance(int64_t{0}, pred, succ, count, count, few), std::out_of_range);
+  CHECK(edits == 0);
+  CHECK(few.size() == 1);
+
+  // Drawing past the end throws instead of handing out foreign ids
+  CHECK(few() == 10);
+  CHECK_THROWS_AS(few(), std::out_of_range);
+  CHECK_THROWS_AS(few.at(0), std::out_of_range);
+  CHECK_THROWS_AS(few.skip(1), std::out_of_range);
+  CHECK(few.size() == 0);
+} // TEST_CASE: celaeno::graph::balance::plan
+
+TEST_CASE("celaeno::graph::balance::fanout")
+{
+  //
+  // A spine 0 -> 1 -> ... -> 6, the root also drives every level and
+  // vertex 1 drives the last two
+  //
+  std::vector<std::pair<int64_t,int64_t>> edges
+    {{0,1},{1,2},{2,3},{3,4},{4,5},{5,6},{0,3},{0,6},{0,2},{0,5},{0,4},{1,5},{1,6}};
+  csr::Graph<int64_t> g{edges};
+  auto pred = [&g](auto&& v){ return g.pred(v); };
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+
+  auto separate {balance::plan(int64_t{0},pred,succ)};
+  auto shared {balance::plan(int64_t{0},pred,succ,balance::Sharing::fanout)};
+  CHECK(separate.pseudo() == 1+2+3+4+5 + 3+4);
+  CHECK(shared.pseudo() == 5 + 4);
+  CHECK(shared.min() == -9);
+
+  // Each chain of a source extends the previous one
+  for (size_t i{1}; i < shared.chains.size(); ++i)
+  {
+    auto const& [a,b] {std::tie(shared.chains[i-1], shared.chains[i])};
+    CHECK(std::make_pair(a.source,a.length) <= std::make_pair(b.source,b.length));
+  } // for: i
+
+  // The expanded and the applied edits agree and balance the graph
+  auto balanced {balance::expand(shared, edges)};
+  std::set<std::pair<int64_t,int64_t>> applied(edges.begin(), edges.end());
+  balance::apply(shared,
+    [&](auto&& e){ applied.insert(e); },
+    [&](auto&& e){ applied.erase(e); });
+  CHECK((applied == std::set<std::pair<int64_t,int64_t>>(balanced.begin(), balanced.end())));
+  CHECK(balanced.size() == applied.size());
+
+  for (auto& [u,v] : balanced) { u -= shared.min(); v -= shared.min(); }
+  csr::Graph<int64_t> h{balanced};
+  auto view {depth::flat(-shared.min(),
+    [&h](auto&& v){ return h.pred(v); },
+    [&h](auto&& v){ return h.succ(v); })};
+  CHECK(view.height() == 7);
+  for (auto const& [u,v] : balanced) { CHECK(view.level(v) - view.level(u) == 1); }
+  CHECK(view.vertices().size() == 7 + static_cast<size_t>(shared.pseudo()));
+} // TEST_CASE: celaeno::graph::balance::fanout
+
+TEST_CASE("celaeno::graph::balance::parallel")
+{
+  // Random DAG, each vertex driven by a few lower ids
+  std::mt19937 gen{11};
+  std::vector<std::pair<int64_t,int64_t>> edges;
+  for (int64_t v{1}; v < 4000; ++v)
+  {
+    std::uniform_int_distribution<int64_t> source{std::max<int64_t>(0, v-300), v-1};
+    for (int32_t k{0}; k < 3; ++k) { edges.emplace_back(source(gen), v); }
+  } // for: v
+  std::ranges::sort(edges);
+  edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+  csr::Graph<int64_t> g{edges};
+  auto pred = [&g](auto&& v){ return g.pred(v); };
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+
+  auto same = [](auto const& a, auto const& b)
+  {
+    REQUIRE(a.counter == b.counter);
+    REQUIRE(a.chains.size() == b.chains.size());
+    for (size_t i{0}; i < a.chains.size(); ++i)
+    {
+      REQUIRE(a.chains[i].source == b.chains[i].source);
+      REQUIRE(a.chains[i].target == b.chains[i].target);
+      REQUIRE(a.chains[i].length == b.chains[i].length);
+    } // for: i
+  };
+
+  for (auto sharing : {balance::Sharing::none, balance::Sharing::fanout})
+  {
+    auto sequential {balance::plan(int64_t{0},pred,succ,sharing)};
+    REQUIRE(sequential.pseudo() > 0);
+    auto expected {balance::expand(sequential, edges)};
+
+    for (size_t threads : {1, 2, 3, 8, 64})
+    {
+      // Same plan and same edges whatever the number of threads
+      auto plan {balance::parallel_plan(int64_t{0},pred,succ,sharing,threads)};
+      same(plan, sequential);
+      CHECK(balance::parallel_expand(plan, edges, threads) == expected);
+
+      // Ids reserved by the caller are consumed as by expand
+      balance::Range<int64_t> a{4000, 4000+plan.pseudo()}, b{4000, 4000+plan.pseudo()};
+      CHECK(balance::parallel_expand(plan, edges, a, threads) == balance::expand(plan, edges, b));
+      CHECK(a.size() == 0);
+      CHECK(b.size() == 0);
+    } // for: threads
+  } // for: sharing
+} // TEST_CASE: celaeno::graph::balance::parallel
+
 } // namespace celaeno::graph::balance::test
@@ -11,6 +11,7 @@
 #include <celaeno/graph/barycenter.hpp>
 #include <sstream>
 #include <iomanip>
+#include <vector>
 #include <fplus/fplus.hpp>
 
 namespace celaeno::graph::barycenter::test
@@ -115,6 +116,17 @@ namespace celaeno::graph::barycenter::test
       })
     );
 
+    // Sparse rows
+    for (auto const& row : m1)
+    {
+      std::vector<std::pair<size_t,int32_t>> sparse;
+      for (size_t i{0}; i < row.size(); ++i)
+      {
+        if( row.at(i) != 0 ) { sparse.emplace_back(i,row.at(i)); }
+      } // for: i
+      CHECK( barycenter::sparse(sparse) == barycenter::run(row) );
+    } // for: row
+
     // compare(m0.at(0),r0.at(0));
     // compare(m0,c0,fn_col);
     // compare(m1.at(0),r1.at(0));
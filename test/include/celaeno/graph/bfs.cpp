@@ -34,9 +34,13 @@
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <celaeno/graph/bfs.hpp>
+#include <celaeno/graph/visited.hpp>
 #include <taygete/graph/graph.hpp>
 #include <taygete/graph/reader.hpp>
 #include <fplus/fplus.hpp>
+#include <set>
+#include <algorithm>
+#include <range/v3/all.hpp>
 #include <maia/circuits/iscas.hpp>
 #include <maia/circuits/synth-91.hpp>
 
@@ -48,9 +52,11 @@ namespace celaeno::graph::bfs::test
 //
 
 namespace bfs = celaeno::graph::bfs;
+namespace visited = celaeno::graph::visited;
 namespace cir = maia::circuits;
 namespace gra = taygete::graph;
 namespace fw = fplus::fwd;
+namespace rv = ranges::views;
 using float64_t = double;
 
 //
@@ -79,6 +85,27 @@ void TEST(T&& str)
   REQUIRE(g.get_node_count() == bfs.size());
 
   REQUIRE(fw::apply(bfs,fw::unique()).size() == bfs.size());
+
+  // Every visited-state policy yields the same traversal
+  auto cb = [](auto&&){ return false; };
+  REQUIRE(bfs::bfs(0,adj,cb,visited::Bitset<int>{}) == bfs);
+  REQUIRE(bfs::bfs(0,adj,cb,std::set<int>{}) == bfs);
+
+  // A stamped workspace is reused after an O(1) clear
+  visited::Stamp<int> workspace;
+  REQUIRE(bfs::bfs(0,adj,cb,workspace) == bfs);
+  workspace.clear();
+  REQUIRE(bfs::bfs(0,adj,cb,workspace) == bfs);
+
+  // The lazy view yields the same sequence on demand
+  std::vector<int> lazy;
+  for (auto v : bfs::lazy(0,adj)) { lazy.push_back(v); }
+  REQUIRE(lazy == bfs);
+
+  std::vector<int> first;
+  for (auto v : bfs::lazy(0,adj) | rv::take(5)) { first.push_back(v); }
+  REQUIRE(first.size() == std::min<size_t>(5,bfs.size()));
+  REQUIRE(std::equal(first.begin(),first.end(),bfs.begin()));
 }
 
 //
@@ -32,6 +32,9 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 #include <celaeno/graph/crossings.hpp>
+#include <random>
+#include <vector>
+#include <array>
 
 //
 // Aliases
@@ -112,6 +115,66 @@ TEST_CASE("celaeno::graph::crossings")
     REQUIRE(c5 == 7);
 
   } // SUBCASE: "Edge crossings count"
+
+  SUBCASE("Edge list crossings count")
+  {
+    // m0 as (north, south) pairs
+    std::vector<std::pair<int64_t,int64_t>> e0
+    {
+      {0,0},{0,1},
+      {1,0},{1,3},{1,4},
+      {2,1},{2,3},{2,4},
+      {3,0},{3,2},{3,4},
+    };
+    REQUIRE(crossings::run(e0) == 14);
+
+    // Weighted edges count each pair of crossing edges w1*w2 times
+    std::vector<std::tuple<int64_t,int64_t,int32_t>> e1 { {0,1,2},{1,0,3} };
+    REQUIRE(crossings::run(e1) == 6);
+
+    std::vector<std::pair<int64_t,int64_t>> empty;
+    REQUIRE(crossings::run(empty) == 0);
+  } // SUBCASE: "Edge list crossings count"
+
+  SUBCASE("Rows that read both ways")
+  {
+    // Weighted triples in std::array rows, also a 3-column matrix
+    using Rows = std::vector<std::array<int64_t,3>>;
+    static_assert(! crossings::Matrix<Rows>);
+    static_assert(! crossings::Edges<Rows>);
+    static_assert(crossings::Matrix<std::array<std::array<int32_t,5>,4>>);
+    static_assert(crossings::Edges<std::vector<std::pair<int64_t,int64_t>>>);
+
+    Rows e1 { {0,1,2},{1,0,3} };
+    REQUIRE(crossings::run(crossings::as_edges, e1) == 6);
+
+    // As a matrix: m[0][1]*m[1][0] + m[0][2]*m[1][0] + m[0][2]*m[1][1]
+    REQUIRE(crossings::run(crossings::as_matrix, e1) == 1*1 + 2*1 + 2*0);
+  } // SUBCASE: "Rows that read both ways"
+
+  SUBCASE("Crossings count against pairwise count")
+  {
+    std::mt19937 gen{42};
+    for (int32_t i{0}; i < 50; ++i)
+    {
+      auto p {std::uniform_int_distribution<size_t>{1,30}(gen)};
+      auto q {std::uniform_int_distribution<size_t>{1,30}(gen)};
+      std::vector<std::vector<int32_t>> m(p, std::vector<int32_t>(q));
+      for (auto& row : m)
+      {
+        for (auto& w : row) { w = std::uniform_int_distribution<int32_t>{0,2}(gen); }
+      } // for: row
+
+      int64_t expected{0};
+      for (size_t j{0}; j < p; ++j)
+        for (size_t k{j+1}; k < p; ++k)
+          for (size_t a{0}; a < q; ++a)
+            for (size_t b{a+1}; b < q; ++b)
+              expected += m[j][b] * m[k][a];
+
+      REQUIRE(crossings::run(m) == expected);
+    } // for: i
+  } // SUBCASE: "Crossings count against pairwise count"
 } // TEST_CASE: "celaeno::graph::crossings"
 
 } // namespace celaeno::graph::crossings::test
@@ -0,0 +1,241 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : csr
+// @created     : Saturday Oct 17, 2026 03:17:38 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <celaeno/graph/csr.hpp>
+#include <celaeno/graph/bfs.hpp>
+#include <celaeno/graph/kahn.hpp>
+#include <taygete/graph/graph.hpp>
+#include <taygete/graph/reader.hpp>
+#include <fplus/fplus.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+#include <unordered_map>
+#include <set>
+
+namespace celaeno::graph::csr::test
+{
+
+//
+// Aliases
+//
+
+namespace csr = celaeno::graph::csr;
+namespace bfs = celaeno::graph::bfs;
+namespace kahn = celaeno::graph::kahn;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+namespace fw = fplus::fwd;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Test Wrapper
+//
+
+template<String T>
+void TEST(T&& str)
+{
+  gra::Graph<int64_t> g;
+  std::vector<std::pair<int64_t,int64_t>> edges;
+  auto emplace = [&g,&edges](auto&& pair)
+    { g.emplace(pair); edges.emplace_back(pair.first,pair.second); };
+  gra::reader::Reader reader{str,emplace};
+
+  REQUIRE(g.get_node_count() > 0);
+
+  csr::Graph c{edges};
+
+  // Repeated edges are stored once, as in the source graph
+  REQUIRE(c.edge_count() == std::set(edges.begin(),edges.end()).size());
+
+  // Neighbors must match the ones of the source graph
+  auto sorted = [](auto&& r)
+    { return fw::apply(std::vector<int64_t>(r.begin(),r.end()),fw::sort()); };
+  for (int64_t v{0}; v < static_cast<int64_t>(c.size()); ++v)
+  {
+    if( c.adj(v).empty() ) continue;
+    REQUIRE(sorted(c.succ(v)) == sorted(g.get_successors(v)));
+    REQUIRE(sorted(c.pred(v)) == sorted(g.get_predecessors(v)));
+    REQUIRE(c.adj(v).size() == c.pred(v).size() + c.succ(v).size());
+  } // for: v
+
+  // Traversals consume the neighbor spans directly
+  auto adj = [&c](auto&& v){ return c.adj(v); };
+  auto pred = [&c](auto&& v){ return c.pred(v); };
+  auto succ = [&c](auto&& v){ return c.succ(v); };
+
+  auto visit {bfs::bfs(int64_t{0},adj)};
+  REQUIRE(g.get_node_count() == visit.size());
+
+  auto topo {kahn::kahn(int64_t{0},pred,succ)};
+  REQUIRE(g.get_node_count() == topo.size());
+
+  std::unordered_map<int64_t,size_t> position;
+  for (size_t i{0}; i < topo.size(); ++i) { position.emplace(topo.at(i),i); }
+  for (auto const& [u,v] : edges) { REQUIRE(position.at(u) < position.at(v)); }
+}
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::csr::Graph"
+  * doctest::description("Vertex ids without edges")
+)
+{
+  csr::Graph c{std::vector<std::pair<int64_t,int64_t>>{{0,2},{2,3},{0,3}}};
+  REQUIRE(c.size() == 4);
+  REQUIRE(c.succ(1).empty());
+  REQUIRE(c.pred(-1).empty());
+  REQUIRE(c.succ(4).empty());
+  REQUIRE(c.pred(3).size() == 2);
+  REQUIRE(c.adj(2).size() == 2);
+  REQUIRE(c.min() == 0);
+} // TEST_CASE: celaeno::graph::csr::Graph
+
+TEST_CASE("celaeno::graph::csr::Graph negative ids"
+  * doctest::description("Balance pseudo vertices below zero")
+)
+{
+  // 0 -> -1 -> -2 -> 3, as balance numbers the pseudo vertices of 0 -> 3
+  csr::Graph c{std::vector<std::pair<int64_t,int64_t>>{{0,-1},{-1,-2},{-2,3},{0,3}}};
+  REQUIRE(c.min() == -2);
+  REQUIRE(c.size() == 6);
+  REQUIRE(c.edge_count() == 4);
+  REQUIRE(c.succ(-3).empty());
+  REQUIRE(c.pred(4).empty());
+  REQUIRE((c.succ(0).size() == 2 && c.succ(0)[0] == -1 && c.succ(0)[1] == 3));
+  REQUIRE((c.pred(-2).size() == 1 && c.pred(-2)[0] == -1));
+  REQUIRE(c.pred(3).size() == 2);
+  REQUIRE(c.adj(-1).size() == 2);
+  REQUIRE(c.succ(1).empty());
+
+  auto topo {kahn::kahn(int64_t{0},
+    [&c](auto&& v){ return c.pred(v); },
+    [&c](auto&& v){ return c.succ(v); })};
+  REQUIRE(topo.size() == 4);
+} // TEST_CASE: celaeno::graph::csr::Graph negative ids
+
+TEST_CASE("celaeno::graph::csr::Graph repeated edges"
+  * doctest::description("Parallel edges are stored once")
+)
+{
+  csr::Graph c{std::vector<std::pair<int64_t,int64_t>>{{0,2},{1,2},{0,2},{2,3},{0,2}}};
+  REQUIRE(c.edge_count() == 3);
+  REQUIRE((c.succ(0).size() == 1 && c.succ(0)[0] == 2));
+  REQUIRE((c.pred(2).size() == 2 && c.pred(2)[0] == 0 && c.pred(2)[1] == 1));
+  REQUIRE(c.adj(2).size() == 3);
+  REQUIRE(c.adj(0).size() == 1);
+
+  auto topo {kahn::kahn(int64_t{0},
+    [&c](auto&& v){ return c.pred(v); },
+    [&c](auto&& v){ return c.succ(v); })};
+  REQUIRE(topo.size() == 4);
+} // TEST_CASE: celaeno::graph::csr::Graph repeated edges
+
+TEST_CASE("celaeno::graph::csr"
+  * doctest::description("Compressed sparse row graph test")
+  * doctest::timeout(10.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::csr", "logs/graph-csr.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for csr.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::csr
+
+} // namespace celaeno::graph::csr::test
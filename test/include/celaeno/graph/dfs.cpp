@@ -35,11 +35,15 @@
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <celaeno/graph/dfs.hpp>
+#include <celaeno/graph/visited.hpp>
 #include <taygete/graph/graph.hpp>
 #include <taygete/graph/reader.hpp>
 #include <maia/circuits/iscas.hpp>
 #include <maia/circuits/synth-91.hpp>
 #include <fplus/fplus.hpp>
+#include <set>
+#include <algorithm>
+#include <range/v3/all.hpp>
 
 namespace celaeno::graph::dfs::test
 {
@@ -49,9 +53,11 @@ namespace celaeno::graph::dfs::test
 //
 
 namespace dfs = celaeno::graph::dfs;
+namespace visited = celaeno::graph::visited;
 namespace cir = maia::circuits;
 namespace gra = taygete::graph;
 namespace fw = fplus::fwd;
+namespace rv = ranges::views;
 using float64_t = double;
 
 //
@@ -80,6 +86,27 @@ void TEST(T&& str)
   REQUIRE(g.get_node_count() == dfs.size());
 
   REQUIRE(fw::apply(dfs,fw::unique()).size() == dfs.size());
+
+  // Every visited-state policy yields the same traversal
+  auto cb = [](auto&&){ return false; };
+  REQUIRE(dfs::dfs(0,adj,cb,visited::Bitset<int>{}) == dfs);
+  REQUIRE(dfs::dfs(0,adj,cb,std::set<int>{}) == dfs);
+
+  // A stamped workspace is reused after an O(1) clear
+  visited::Stamp<int> workspace;
+  REQUIRE(dfs::dfs(0,adj,cb,workspace) == dfs);
+  workspace.clear();
+  REQUIRE(dfs::dfs(0,adj,cb,workspace) == dfs);
+
+  // The lazy view yields the same sequence on demand
+  std::vector<int> lazy;
+  for (auto v : dfs::lazy(0,adj)) { lazy.push_back(v); }
+  REQUIRE(lazy == dfs);
+
+  std::vector<int> first;
+  for (auto v : dfs::lazy(0,adj) | rv::take(5)) { first.push_back(v); }
+  REQUIRE(first.size() == std::min<size_t>(5,dfs.size()));
+  REQUIRE(std::equal(first.begin(),first.end(),dfs.begin()));
 }
 
 //
@@ -0,0 +1,239 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : jps
+// @created     : Saturday Oct 17, 2026 03:49:10 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/graph/jps.hpp>
+
+#include <cmath>
+#include <algorithm>
+#include <deque>
+#include <tuple>
+#include <limits>
+#include <queue>
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace celaeno::graph::jps::test
+{
+
+//
+// Aliases
+//
+namespace jps = celaeno::graph::jps;
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+using Cell = std::pair<int64_t,int64_t>;
+
+//
+// Helpers
+//
+
+// Dijkstra over every move of the grid, the reference cost
+template<typename F>
+float64_t dijkstra(a_star::Bounds const& bounds, Cell s, Cell t, F&& blocked, bool eight)
+{
+  auto free = [&](Cell const& c){ return bounds.contains(c) && ! blocked(c); };
+  if( ! free(s) || ! free(t) ) return -1;
+
+  std::vector<float64_t> dist(bounds.size(), std::numeric_limits<float64_t>::infinity());
+  std::priority_queue<std::pair<float64_t,int64_t>,
+    std::vector<std::pair<float64_t,int64_t>>, std::greater<>> open;
+  dist.at(static_cast<size_t>(bounds.index(s))) = 0;
+  open.emplace(0, bounds.index(s));
+
+  while( ! open.empty() )
+  {
+    auto [d,i] {open.top()};
+    open.pop();
+    if( d > dist.at(static_cast<size_t>(i)) ) continue;
+    auto c {bounds.cell(i)};
+    if( c == t ) return d;
+
+    for (int64_t dx{-1}; dx <= 1; ++dx)
+    {
+      for (int64_t dy{-1}; dy <= 1; ++dy)
+      {
+        bool diagonal {dx != 0 && dy != 0};
+        if( (dx == 0 && dy == 0) || (diagonal && ! eight) ) continue;
+        Cell n {c.first+dx, c.second+dy};
+        if( ! free(n) ) continue;
+        if( diagonal && (! free({c.first+dx,c.second}) || ! free({c.first,c.second+dy})) ) continue;
+        auto nd {d + (diagonal? std::sqrt(2.) : 1.)};
+        auto j {static_cast<size_t>(bounds.index(n))};
+        if( nd < dist.at(j) - 1e-9 ) { dist.at(j) = nd; open.emplace(nd, bounds.index(n)); }
+      } // for: dy
+    } // for: dx
+  } // while
+
+  return -1;
+}
+
+// Cost of a path of adjacent cells, checking each move
+template<typename F>
+float64_t cost(std::deque<Cell> const& path, F&& blocked, bool eight)
+{
+  if( path.empty() ) return -1;
+  float64_t c{0};
+  for (size_t i{1}; i < path.size(); ++i)
+  {
+    auto const& [a,b] {std::tie(path.at(i-1), path.at(i))};
+    auto [dx,dy] {std::make_pair(b.first-a.first, b.second-a.second)};
+    REQUIRE(std::abs(dx) <= 1);
+    REQUIRE(std::abs(dy) <= 1);
+    REQUIRE(! blocked(b));
+    if( dx != 0 && dy != 0 )
+    {
+      REQUIRE(eight);
+      REQUIRE(! blocked(Cell{a.first+dx,a.second}));
+      REQUIRE(! blocked(Cell{a.first,a.second+dy}));
+      c += std::sqrt(2.);
+    }
+    else
+    {
+      c += 1.;
+    } // if
+  } // for: i
+  return c;
+}
+
+//
+// Tests
+//
+
+TEST_CASE("celaeno::graph::jps")
+{
+  SUBCASE("Optimal paths on random obstacle maps")
+  {
+    std::mt19937 gen{5};
+    for (int64_t trial{0}; trial < 40; ++trial)
+    {
+      auto size {10 + trial % 30};
+      a_star::Bounds bounds{{-3,2},{size-4,size+1}};
+      std::bernoulli_distribution density{0.05 + 0.1 * static_cast<float64_t>(trial % 4)};
+      std::vector<bool> obstacles(bounds.size());
+      for (size_t i{0}; i < obstacles.size(); ++i) { obstacles[i] = density(gen); }
+      auto blocked = [&](auto&& c){ return obstacles.at(static_cast<size_t>(bounds.index(c))); };
+
+      for (auto connectivity : {jps::Connectivity::four, jps::Connectivity::eight})
+      {
+        bool eight {connectivity == jps::Connectivity::eight};
+        jps::Plus plus{bounds, blocked, connectivity};
+        a_star::SearchContext ctx;
+        std::uniform_int_distribution<int64_t> row{bounds.min.first,bounds.max.first};
+        std::uniform_int_distribution<int64_t> col{bounds.min.second,bounds.max.second};
+
+        for (int32_t k{0}; k < 30; ++k)
+        {
+          Cell s {row(gen),col(gen)}, t {row(gen),col(gen)};
+          auto expected {dijkstra(bounds, s, t, blocked, eight)};
+          auto walked {jps::jps(bounds, s, t, blocked, connectivity, ctx)};
+          auto table {jps::jps(plus, s, t, ctx)};
+
+          CHECK(walked == table);
+          if( expected < 0 )
+          {
+            CHECK(walked.empty());
+            continue;
+          } // if
+          REQUIRE(walked.front() == s);
+          REQUIRE(walked.back() == t);
+          CHECK(std::abs(cost(walked, blocked, eight) - expected) < 1e-9);
+        } // for: k
+      } // for: connectivity
+    } // for: trial
+  } // SUBCASE: Optimal paths on random obstacle maps
+
+  SUBCASE("Four-connected paths match a_star")
+  {
+    a_star::Bounds bounds{{0,0},{99,99}};
+    auto blocked = [](auto&& c){ return c.second % 10 == 5 && c.first % 17 != 0; };
+    auto neighbors = [&](auto&& c)
+    {
+      std::vector<Cell> n {{c.first+1,c.second},{c.first-1,c.second},{c.first,c.second+1},{c.first,c.second-1}};
+      std::erase_if(n, [&](auto&& x){ return blocked(x); });
+      return n;
+    };
+
+    jps::Plus plus{bounds, blocked, jps::Connectivity::four};
+    for (int64_t i{0}; i < 100; i += 7)
+    {
+      Cell s {i,0}, t {99-i,99};
+      auto h = [&t](auto&& p) -> float64_t { return std::abs(p.first-t.first) + std::abs(p.second-t.second); };
+      auto expected {a_star::a_star(bounds, s, t, neighbors, [](auto&&){ return 1; }, h)};
+      CHECK(jps::jps(plus, s, t).size() == expected.size());
+      CHECK(jps::jps(bounds, s, t, blocked, jps::Connectivity::four).size() == expected.size());
+    } // for: i
+  } // SUBCASE: Four-connected paths match a_star
+
+  SUBCASE("Straight moves only branch at forced neighbors")
+  {
+    // Pillars on every eighth row and column
+    a_star::Bounds bounds{{0,0},{63,63}};
+    auto pillar = [](auto&& c){ return c.first % 8 == 4 && c.second % 8 == 4; };
+
+    for (auto connectivity : {jps::Connectivity::four, jps::Connectivity::eight})
+    {
+      bool eight {connectivity == jps::Connectivity::eight};
+      jps::Plus plus{bounds, pillar, connectivity};
+
+      // Open cell, only the forward move remains
+      CHECK(jps::directions(plus, Cell{1,10}, Cell{1,0}) == std::vector<Cell>{{1,0}});
+
+      // Past the pillar at (4,4) the cell beside it is forced
+      auto forced {jps::directions(plus, Cell{5,3}, Cell{1,0})};
+      CHECK(std::ranges::count(forced, Cell{0,1}) == 1);
+      CHECK(std::ranges::count(forced, Cell{1,1}) == (eight? 1 : 0));
+      CHECK(std::ranges::count(forced, Cell{0,-1}) == 0);
+
+      // Each cell is looked up a bounded number of times
+      size_t queries{0};
+      auto blocked = [&](auto&& c){ ++queries; return pillar(c); };
+      auto path {jps::jps(bounds, Cell{0,0}, Cell{63,50}, blocked, connectivity)};
+      REQUIRE(! path.empty());
+      CHECK(std::abs(cost(path, pillar, eight) - dijkstra(bounds, Cell{0,0}, Cell{63,50}, pillar, eight)) < 1e-9);
+      CHECK(queries < 7 * bounds.size());
+    } // for: connectivity
+  } // SUBCASE: Straight moves only branch at forced neighbors
+
+  SUBCASE("Blocked terminals")
+  {
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto blocked = [](auto&& c){ return c == Cell{5,5}; };
+    CHECK(jps::jps(bounds, Cell{0,0}, Cell{5,5}, blocked).empty());
+    CHECK(jps::jps(bounds, Cell{0,0}, Cell{10,5}, blocked).empty());
+    CHECK(jps::jps(bounds, Cell{3,3}, Cell{3,3}, blocked).size() == 1);
+  } // SUBCASE: Blocked terminals
+
+} // TEST_CASE: celaeno::graph::jps
+
+} // namespace celaeno::graph::jps::test
@@ -39,6 +39,9 @@
 #include <taygete/graph/reader.hpp>
 #include <maia/circuits/iscas.hpp>
 #include <maia/circuits/synth-91.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <range/v3/all.hpp>
 
 
 namespace celaeno::graph::kahn::test
@@ -50,6 +53,7 @@ namespace celaeno::graph::kahn::test
 namespace cir = maia::circuits;
 namespace gra = taygete::graph;
 namespace fw = fplus::fwd;
+namespace rv = ranges::views;
 using float64_t = double;
 
 //
@@ -95,6 +99,32 @@ void TEST(T&& str)
 
   REQUIRE(fw::apply(result,fw::unique()).size() == result.size());
 
+  // Each vertex must come before all of its successors
+  std::unordered_map<int64_t,size_t> position;
+  for (size_t i{0}; i < result.size(); ++i) { position.emplace(result.at(i),i); }
+  for (auto const& v : result)
+  {
+    for (auto const& s : succ(v))
+    {
+      REQUIRE(position.at(v) < position.at(s));
+    } // for: s
+  } // for: v
+
+  // The lazy view yields the same sequence on demand
+  std::vector<int> lazy;
+  for (auto v : celaeno::graph::kahn::lazy(0,pred,succ)) { lazy.push_back(v); }
+  REQUIRE(lazy == result);
+
+  // Sources come first, take_while stops at the first inner vertex
+  std::vector<int> sources;
+  auto is_source = [&g](auto&& v){ return g.get_predecessors(v).empty(); };
+  for (auto v : celaeno::graph::kahn::lazy(0,pred,succ) | rv::take_while(is_source))
+  {
+    sources.push_back(v);
+  }
+  REQUIRE(! sources.empty());
+  REQUIRE(std::equal(sources.begin(),sources.end(),result.begin()));
+
 } // function: TEST
 
 //
@@ -0,0 +1,214 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : lpa-star
+// @created     : Saturday Oct 17, 2026 03:52:45 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/graph/lpa-star.hpp>
+
+#include <cmath>
+#include <deque>
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace celaeno::graph::lpa_star::test
+{
+
+//
+// Aliases
+//
+namespace lpa_star = celaeno::graph::lpa_star;
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+using Cell = std::pair<int64_t,int64_t>;
+
+//
+// Helpers
+//
+
+auto neighbors = [](auto&& c)
+{
+  return std::vector<Cell>{{c.first+1,c.second},{c.first-1,c.second},{c.first,c.second+1},{c.first,c.second-1}};
+};
+
+// Cost of a path of adjacent cells, each entry charged by f_distance
+template<typename F>
+float64_t cost(std::deque<Cell> const& path, F&& f_distance)
+{
+  float64_t c{0};
+  for (size_t i{1}; i < path.size(); ++i)
+  {
+    REQUIRE(std::abs(path.at(i).first-path.at(i-1).first) + std::abs(path.at(i).second-path.at(i-1).second) == 1);
+    c += f_distance(path.at(i));
+  } // for: i
+  return c;
+}
+
+//
+// Tests
+//
+
+TEST_CASE("celaeno::graph::lpa_star")
+{
+  constexpr auto inf {std::numeric_limits<float64_t>::infinity()};
+
+  SUBCASE("Replanning matches a fresh search")
+  {
+    std::mt19937 gen{7};
+    a_star::Bounds bounds{{-2,3},{37,42}};
+    Cell s {-2,3}, t {37,42};
+    std::vector<float64_t> weights(bounds.size(), 1.);
+    auto distance = [&](auto&& c){ return weights.at(static_cast<size_t>(bounds.index(c))); };
+    auto h = [&t](auto&& p) -> float64_t { return std::abs(p.first-t.first) + std::abs(p.second-t.second); };
+
+    auto planner {lpa_star::planner(bounds, s, t, neighbors, distance, h)};
+    std::uniform_int_distribution<int64_t> index{0, static_cast<int64_t>(bounds.size())-1};
+    std::uniform_int_distribution<int32_t> weight{0, 3};
+
+    size_t full{0};
+    for (int32_t step{0}; step < 200; ++step)
+    {
+      // Toggle a few obstacles and weights, keeping the terminals free
+      for (int32_t k{0}; k < 3; ++k)
+      {
+        auto c {bounds.cell(index(gen))};
+        if( c == s || c == t ) continue;
+        auto w {weight(gen)};
+        weights.at(static_cast<size_t>(bounds.index(c))) = (w == 0)? inf : static_cast<float64_t>(w);
+        planner.update(c);
+      } // for: k
+
+      auto expected {a_star::a_star(bounds, s, t, neighbors, distance, h)};
+      auto path {planner.path()};
+      REQUIRE(path.empty() == expected.empty());
+      if( path.empty() )
+      {
+        CHECK(planner.cost() == inf);
+        continue;
+      } // if
+      REQUIRE(path.front() == s);
+      REQUIRE(path.back() == t);
+      CHECK(cost(path, distance) == cost(expected, distance));
+      CHECK(planner.cost() == cost(path, distance));
+
+      // Expansions of a planner built from scratch on the same grid
+      auto fresh {lpa_star::planner(bounds, s, t, neighbors, distance, h)};
+      fresh.path();
+      full += fresh.expansions();
+    } // for: step
+
+    CHECK(planner.expansions() < full);
+  } // SUBCASE: Replanning matches a fresh search
+
+  SUBCASE("Walls cut and reopened")
+  {
+    a_star::Bounds bounds{{0,0},{19,19}};
+    Cell s {0,0}, t {19,19};
+    std::vector<bool> wall(bounds.size(), false);
+    auto distance = [&](auto&& c){ return wall.at(static_cast<size_t>(bounds.index(c)))? inf : 1.; };
+    auto h = [&t](auto&& p) -> float64_t { return std::abs(p.first-t.first) + std::abs(p.second-t.second); };
+    auto planner {lpa_star::planner(bounds, s, t, neighbors, distance, h)};
+
+    CHECK(planner.cost() == 38);
+
+    // A full column disconnects the terminals
+    for (int64_t r{0}; r < 20; ++r) { wall.at(static_cast<size_t>(bounds.index(Cell{r,10}))) = true; planner.update(Cell{r,10}); }
+    CHECK(planner.path().empty());
+    CHECK(planner.cost() == inf);
+
+    // A gap on the far row forces a detour through it
+    wall.at(static_cast<size_t>(bounds.index(Cell{19,10}))) = false;
+    planner.update(Cell{19,10});
+    auto path {planner.path()};
+    REQUIRE(! path.empty());
+    CHECK(std::find(path.begin(), path.end(), Cell{19,10}) != path.end());
+    CHECK(planner.cost() == 38);
+
+    // Moving the gap to the near row keeps the path optimal
+    wall.at(static_cast<size_t>(bounds.index(Cell{19,10}))) = true;
+    wall.at(static_cast<size_t>(bounds.index(Cell{0,10}))) = false;
+    planner.update(Cell{19,10});
+    planner.update(Cell{0,10});
+    CHECK(planner.cost() == 38);
+    CHECK(cost(planner.path(), distance) == 38);
+  } // SUBCASE: Walls cut and reopened
+
+  SUBCASE("Zero-cost cells")
+  {
+    // Every cell shares the same distance, the walk back must still advance
+    auto zero = [](auto&&) -> int32_t { return 0; };
+    auto h = [](auto&&) -> float64_t { return 0; };
+
+    a_star::Bounds strip{{0,0},{0,3}};
+    auto planner {lpa_star::planner(strip, Cell{0,0}, Cell{0,3}, neighbors, zero, h)};
+    CHECK(planner.cost() == 0);
+    CHECK(planner.path() == std::deque<Cell>{{0,0},{0,1},{0,2},{0,3}});
+
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto grid {lpa_star::planner(bounds, Cell{0,0}, Cell{9,9}, neighbors, zero, h)};
+    auto path {grid.path()};
+    REQUIRE(! path.empty());
+    CHECK(path.front() == Cell{0,0});
+    CHECK(path.back() == Cell{9,9});
+    CHECK(cost(path, zero) == 0);
+  } // SUBCASE: Zero-cost cells
+
+  SUBCASE("Unreachable goal")
+  {
+    // The goal is walled in from the start
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto distance = [](auto&& c){ return (c.second == 5)? inf : 1.; };
+    auto h = [](auto&&) -> float64_t { return 0; };
+    auto planner {lpa_star::planner(bounds, Cell{0,0}, Cell{9,9}, neighbors, distance, h)};
+    CHECK(planner.path().empty());
+    CHECK(planner.cost() == inf);
+
+    // Neighbors that never leave the start row
+    auto row = [](auto&& c){ return std::vector<Cell>{{c.first,c.second+1},{c.first,c.second-1}}; };
+    auto isolated {lpa_star::planner(bounds, Cell{0,0}, Cell{9,0}, row,
+      [](auto&&){ return 1.; }, h)};
+    CHECK(isolated.path().empty());
+    CHECK(isolated.cost() == inf);
+  } // SUBCASE: Unreachable goal
+
+  SUBCASE("Terminals outside the bounds")
+  {
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto planner {lpa_star::planner(bounds, Cell{0,0}, Cell{10,10}, neighbors,
+      [](auto&&){ return 1.; }, [](auto&&){ return 0.; })};
+    CHECK(planner.path().empty());
+    CHECK(planner.cost() == inf);
+  } // SUBCASE: Terminals outside the bounds
+} // TEST_CASE: celaeno::graph::lpa_star
+
+} // namespace celaeno::graph::lpa_star::test
@@ -14,6 +14,8 @@
 // Tested algorithm
 #include <celaeno/graph/matrix-realization.hpp>
 #include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/crossings.hpp>
+#include <celaeno/graph/barycenter.hpp>
 
 #include <range/v3/all.hpp>
 #include <fplus/fplus.hpp>
@@ -26,6 +28,8 @@ namespace celaeno::graph::matrix_realization::test
 //
 namespace graph = taygete::graph;
 namespace matrix_realization = celaeno::graph::matrix_realization;
+namespace crossings = celaeno::graph::crossings;
+namespace barycenter = celaeno::graph::barycenter;
 namespace fw = fplus::fwd;
 
 //
@@ -45,6 +49,25 @@ void compare(C1&& c1, C2&& c2)
   } // for: i
 } // function: compare
 
+// Sparse matrix against its dense counterpart, and the counts
+// computed on each
+template<typename S, typename D>
+void compare_sparse(S&& sparse, D&& dense)
+{
+  REQUIRE(sparse.rows() == dense.size());
+  for (size_t r{0}; r < dense.size(); ++r)
+  {
+    REQUIRE(sparse.cols() == dense.at(r).size());
+    for (size_t c{0}; c < dense.at(r).size(); ++c)
+    {
+      REQUIRE(sparse.at(r,c) == dense.at(r).at(c));
+      REQUIRE(sparse.transpose().at(c,r) == dense.at(r).at(c));
+    } // for: c
+    REQUIRE(barycenter::run(sparse,r) == barycenter::run(dense.at(r)));
+  } // for: r
+  REQUIRE(crossings::run(sparse) == crossings::run(dense));
+} // function: compare_sparse
+
 //
 // Tests
 //
@@ -162,6 +185,12 @@ TEST_CASE("celaeno::graph::matrix_realization"
     compare(matrices.at(1),m2);
     compare(matrices.at(2),m3);
 
+    auto sparse {matrix_realization::sparse(get_layer, succ, height)};
+    REQUIRE(sparse.size() == 3);
+    compare_sparse(sparse.at(0),matrices.at(0));
+    compare_sparse(sparse.at(1),matrices.at(1));
+    compare_sparse(sparse.at(2),matrices.at(2));
+
   } // SUBCASE: "Even number of layers"
 
   SUBCASE("Odd number of layers")
@@ -235,8 +264,71 @@ TEST_CASE("celaeno::graph::matrix_realization"
     compare(matrices.at(0),m1);
     compare(matrices.at(1),m2);
 
+    auto sparse {matrix_realization::sparse(get_layer, succ, height)};
+    REQUIRE(sparse.size() == 2);
+    compare_sparse(sparse.at(0),matrices.at(0));
+    compare_sparse(sparse.at(1),matrices.at(1));
+
   } // SUBCASE: "Odd number of layers"
 
+  SUBCASE("Flat depth view")
+  {
+    graph::Graph<int64_t> g;
+    // Layer 1 → 2
+    g.emplace(std::make_pair(1,3));
+    g.emplace(std::make_pair(1,4));
+    g.emplace(std::make_pair(1,5));
+    g.emplace(std::make_pair(1,6));
+    g.emplace(std::make_pair(2,3));
+    g.emplace(std::make_pair(2,6));
+    // Layer 2 → 3
+    g.emplace(std::make_pair(3,7));
+    g.emplace(std::make_pair(5,7));
+    g.emplace(std::make_pair(5,10));
+    g.emplace(std::make_pair(4,8));
+    g.emplace(std::make_pair(4,9));
+    g.emplace(std::make_pair(4,10));
+    // Layer 3 → 4
+    g.emplace(std::make_pair(7,11));
+    g.emplace(std::make_pair(9,11));
+    g.emplace(std::make_pair(9,13));
+    g.emplace(std::make_pair(10,11));
+    g.emplace(std::make_pair(10,12));
+
+    //
+    // Create hierarchical graph
+    //
+    auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
+    auto succ = [&g](auto&& v){ return g.get_successors(v); };
+    auto h {celaeno::graph::views::depth::flat(int64_t{1},pred,succ)};
+
+    //
+    // Lambda to obtain a layer by index
+    //
+    auto get_layer = [&h](int64_t idx)
+    {
+      auto layer {h.vertices(idx)};
+      return fw::apply(std::vector<int64_t>(layer.begin(),layer.end()), fw::sort());
+    };
+
+    //
+    // Lambda to verify if an edge between v → u exists
+    //
+    auto has_edge = [&g](int64_t v, int64_t u){ return g.exists_edge(v,u); };
+
+    auto matrices
+      {matrix_realization::matrix_realization(get_layer, has_edge, h.height())};
+
+    //
+    // TESTS
+    //
+    REQUIRE(matrices.size() == 3);
+    compare(matrices.at(0),m1);
+    compare(matrices.at(1),m2);
+    compare(matrices.at(2),m3);
+
+  } // SUBCASE: "Flat depth view"
+
 } // TEST_CASE: celaeno::graph::matrix_realization
 
 } // namespace celaeno::graph::matrix_realization::test
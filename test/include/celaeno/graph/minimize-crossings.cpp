@@ -0,0 +1,234 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : minimize-crossings
+// @created     : Saturday Oct 17, 2026 03:33:30 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <celaeno/graph/minimize-crossings.hpp>
+#include <celaeno/graph/matrix-realization.hpp>
+#include <celaeno/graph/crossings.hpp>
+#include <celaeno/graph/balance.hpp>
+#include <celaeno/graph/views/depth.hpp>
+#include <taygete/graph/graph.hpp>
+#include <taygete/graph/reader.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+
+namespace celaeno::graph::minimize_crossings::test
+{
+
+//
+// Aliases
+//
+namespace minimize_crossings = celaeno::graph::minimize_crossings;
+namespace matrix_realization = celaeno::graph::matrix_realization;
+namespace crossings = celaeno::graph::crossings;
+namespace balance = celaeno::graph::balance;
+namespace depth = celaeno::graph::views::depth;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+using float64_t = double;
+using Matrix = std::vector<std::vector<int32_t>>;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Helpers
+//
+
+// Crossings of the matrices with rows and columns permuted by the orders
+int64_t permuted(std::vector<Matrix> const& matrices, std::vector<std::vector<int64_t>> const& order)
+{
+  int64_t total{0};
+  for (size_t l{0}; l < matrices.size(); ++l)
+  {
+    Matrix m;
+    for (auto const& r : order.at(l))
+    {
+      m.emplace_back();
+      for (auto const& c : order.at(l+1)) { m.back().push_back(matrices.at(l).at(r).at(c)); }
+    } // for: r
+    total += crossings::run(m);
+  } // for: l
+  return total;
+} // function: permuted
+
+//
+// Test Wrapper
+//
+template<String T>
+void TEST(T&& str)
+{
+  gra::Graph<int64_t> g;
+  auto emplace = [&g](auto&& pair){ g.emplace(pair); };
+  gra::reader::Reader reader{str,emplace};
+
+  auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
+  auto succ = [&g](auto&& v){ return g.get_successors(v); };
+  auto link = [&g](auto&& pair){ g.emplace(pair); };
+  auto unlink = [&g](auto&& pair){ g.erase(pair); };
+
+  balance::balance(int64_t{0},pred,succ,link,unlink);
+
+  auto h {depth::flat(int64_t{0},pred,succ)};
+  auto get_layer = [&h](int64_t idx)
+  {
+    auto layer {h.vertices(idx)};
+    return std::vector<int64_t>(layer.begin(),layer.end());
+  };
+  auto has_edge = [&g](int64_t v, int64_t u){ return g.exists_edge(v,u); };
+  auto matrices {matrix_realization::matrix_realization(get_layer, has_edge, h.height())};
+
+  std::vector<std::vector<int64_t>> identity;
+  for (size_t l{0}; l < h.height(); ++l)
+  {
+    identity.emplace_back(h.vertices(static_cast<int64_t>(l)).size());
+    std::iota(identity.back().begin(), identity.back().end(), int64_t{0});
+  } // for: l
+
+  auto [order,count] {minimize_crossings::run(matrices)};
+
+  // Each order is a permutation of its layer
+  REQUIRE(order.size() == h.height());
+  for (size_t l{0}; l < order.size(); ++l)
+  {
+    auto sorted {order.at(l)};
+    std::ranges::sort(sorted);
+    REQUIRE(sorted == identity.at(l));
+  } // for: l
+
+  // The count matches the permuted matrices and never exceeds the start
+  REQUIRE(count == permuted(matrices, order));
+  REQUIRE(count <= permuted(matrices, identity));
+
+  // Sparse matrices go through the same sweeps
+  auto sparse {matrix_realization::sparse(get_layer, succ, h.height())};
+  auto [sparse_order,sparse_count] {minimize_crossings::run(sparse)};
+  REQUIRE(sparse_order == order);
+  REQUIRE(sparse_count == count);
+
+} // function: TEST
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::minimize_crossings"
+  * doctest::description("Crossing minimization test")
+  * doctest::timeout(100.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::minimize_crossings", "logs/graph-minimize-crossings.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Crossings removed by swapping two vertices
+  //
+
+  std::vector<Matrix> twisted
+  {
+    {{0,1},{1,0}},
+    {{1,0},{0,1}},
+  };
+  auto [order,count] {minimize_crossings::run(twisted)};
+  REQUIRE(count == 0);
+  REQUIRE(permuted(twisted, order) == 0);
+
+  // Orders given by the caller are the starting point
+  std::vector<std::vector<int64_t>> given {{1,0},{0,1},{1,0}};
+  REQUIRE(minimize_crossings::run(twisted, given) == 0);
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for minimize-crossings.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::minimize_crossings
+
+} // namespace celaeno::graph::minimize_crossings::test
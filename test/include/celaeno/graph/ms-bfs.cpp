@@ -0,0 +1,191 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : ms-bfs
+// @created     : Saturday Oct 17, 2026 03:25:43 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <celaeno/graph/ms-bfs.hpp>
+#include <celaeno/graph/csr.hpp>
+#include <celaeno/graph/bfs.hpp>
+#include <taygete/graph/reader.hpp>
+#include <fplus/fplus.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+#include <numeric>
+
+namespace celaeno::graph::ms_bfs::test
+{
+
+//
+// Aliases
+//
+
+namespace ms_bfs = celaeno::graph::ms_bfs;
+namespace bfs = celaeno::graph::bfs;
+namespace csr = celaeno::graph::csr;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+namespace fw = fplus::fwd;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Test Wrapper
+//
+
+template<String T>
+void TEST(T&& str)
+{
+  std::vector<std::pair<int64_t,int64_t>> edges;
+  auto emplace = [&edges](auto&& pair){ edges.emplace_back(pair.first,pair.second); };
+  gra::reader::Reader reader{str,emplace};
+
+  csr::Graph g{edges};
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+
+  // Fan-out cone of every primary input, plus every vertex as a source to
+  // cover several batches
+  std::vector<int64_t> inputs;
+  for (int64_t v{0}; v < static_cast<int64_t>(g.size()); ++v)
+  {
+    if( g.pred(v).empty() && ! g.succ(v).empty() ) { inputs.push_back(v); }
+  } // for: v
+  std::vector<int64_t> all(g.size());
+  std::iota(all.begin(), all.end(), 0);
+
+  for (auto const& sources : {inputs, all})
+  {
+    auto cones {ms_bfs::ms_bfs(sources,g.size(),succ)};
+    auto cones_simd {ms_bfs::ms_bfs<4>(sources,g.size(),succ)};
+    REQUIRE(cones.size() == sources.size());
+
+    for (size_t i{0}; i < sources.size(); ++i)
+    {
+      auto expected {fw::apply(bfs::bfs(sources.at(i),succ),fw::sort())};
+      REQUIRE(fw::apply(cones.at(i),fw::sort()) == expected);
+      REQUIRE(fw::apply(cones_simd.at(i),fw::sort()) == expected);
+      REQUIRE(cones.at(i).front() == sources.at(i));
+    } // for: i
+  } // for: sources
+
+  // Levels match the distance from each source
+  std::vector<std::vector<int64_t>> level(inputs.size(), std::vector<int64_t>(g.size(),-1));
+  ms_bfs::ms_bfs(inputs,g.size(),succ,[&level](size_t s, int64_t v, int64_t l)
+    { REQUIRE(level.at(s).at(v) == -1); level.at(s).at(v) = l; });
+  for (size_t i{0}; i < inputs.size(); ++i)
+  {
+    for (auto const& [u,v] : edges)
+    {
+      if( level.at(i).at(u) >= 0 ) { REQUIRE(level.at(i).at(v) >= 0); }
+      if( level.at(i).at(u) >= 0 ) { REQUIRE(level.at(i).at(v) <= level.at(i).at(u)+1); }
+    } // for: edges
+  } // for: i
+}
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::ms_bfs"
+  * doctest::description("Multi-source BFS test")
+  * doctest::timeout(10.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::ms_bfs", "logs/graph-ms-bfs.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for ms-bfs.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::ms_bfs
+
+} // namespace celaeno::graph::ms_bfs::test
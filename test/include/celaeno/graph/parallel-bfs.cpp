@@ -0,0 +1,188 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : parallel-bfs
+// @created     : Saturday Oct 17, 2026 03:22:26 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <celaeno/graph/parallel-bfs.hpp>
+#include <celaeno/graph/csr.hpp>
+#include <celaeno/graph/bfs.hpp>
+#include <taygete/graph/reader.hpp>
+#include <fplus/fplus.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+#include <queue>
+
+namespace celaeno::graph::parallel_bfs::test
+{
+
+//
+// Aliases
+//
+
+namespace pbfs = celaeno::graph::parallel_bfs;
+namespace bfs = celaeno::graph::bfs;
+namespace csr = celaeno::graph::csr;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+namespace fw = fplus::fwd;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Test Wrapper
+//
+
+template<String T>
+void TEST(T&& str)
+{
+  std::vector<std::pair<int64_t,int64_t>> edges;
+  auto emplace = [&edges](auto&& pair){ edges.emplace_back(pair.first,pair.second); };
+  gra::reader::Reader reader{str,emplace};
+
+  csr::Graph g{edges};
+  auto adj = [&g](auto&& v){ return g.adj(v); };
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+  auto pred = [&g](auto&& v){ return g.pred(v); };
+
+  // Serial levels over the same adjacency
+  auto levels_of = [&g](auto&& f)
+  {
+    std::vector<int64_t> level(g.size(), -1);
+    std::queue<int64_t> queue; queue.push(0); level.at(0) = 0;
+    while( ! queue.empty() )
+    {
+      auto u {queue.front()}; queue.pop();
+      for (auto v : f(u)) { if( level.at(v) < 0 ) { level.at(v) = level.at(u)+1; queue.push(v); } }
+    } // while
+    return level;
+  };
+  auto level_adj {levels_of(adj)};
+  auto level_succ {levels_of(succ)};
+
+  auto visit {fw::apply(bfs::bfs(int64_t{0},adj), fw::sort())};
+
+  for (size_t threads : {1, 2, 4})
+  {
+    // Default switching, bottom-up as early as possible, mostly top-down
+    std::vector<std::pair<int64_t,int64_t>> tuning {{14,24},{int64_t{1}<<40,int64_t{1}<<40},{1,1}};
+    for (auto [alpha,beta] : tuning)
+    {
+      auto [order,level] {pbfs::parallel_bfs(int64_t{0},g.size(),adj,adj,threads,alpha,beta)};
+      REQUIRE(fw::apply(order, fw::sort()) == visit);
+      REQUIRE(level == level_adj);
+
+      auto [order_succ,level_s] {pbfs::parallel_bfs(int64_t{0},g.size(),succ,pred,threads,alpha,beta)};
+      REQUIRE(level_s == level_succ);
+      REQUIRE(fw::apply(order_succ, fw::unique()).size() == order_succ.size());
+    } // for: alpha,beta
+  } // for: threads
+}
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::parallel_bfs"
+  * doctest::description("Direction-optimizing parallel BFS test")
+  * doctest::timeout(10.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::parallel_bfs", "logs/graph-parallel-bfs.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for parallel-bfs.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::parallel_bfs
+
+} // namespace celaeno::graph::parallel_bfs::test
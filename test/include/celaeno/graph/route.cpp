@@ -0,0 +1,266 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : route
+// @created     : Saturday Oct 17, 2026 03:41:01 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/graph/route.hpp>
+
+#include <set>
+#include <array>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <utility>
+
+namespace celaeno::graph::route::test
+{
+
+//
+// Aliases
+//
+namespace route = celaeno::graph::route;
+namespace a_star = celaeno::graph::a_star;
+using float64_t = double;
+
+//
+// Helpers
+//
+template<typename T1, typename T2>
+int64_t manhattan(T1&& p1, T2&& p2) noexcept
+{
+  return std::abs(p1.first - p2.first) + std::abs(p1.second - p2.second);
+}
+
+// Four-neighbour grid without the cells marked as blocked
+template<typename F>
+auto neighbors(F&& blocked)
+{
+  return [blocked](auto&& pair)
+  {
+    std::vector<std::pair<int64_t,int64_t>> n
+      {
+        {pair.first+1,pair.second},
+        {pair.first-1,pair.second},
+        {pair.first,pair.second+1},
+        {pair.first,pair.second-1},
+      };
+    std::erase_if(n, blocked);
+    return n;
+  };
+}
+
+// Every routed path connects its net through adjacent cells
+void check(a_star::Bounds const& bounds, std::vector<route::Net> const& nets, route::Result const& res)
+{
+  REQUIRE(res.paths.size() == nets.size());
+  for (size_t i{0}; i < nets.size(); ++i)
+  {
+    auto const& path {res.paths.at(i)};
+    REQUIRE(! path.empty());
+    REQUIRE(path.front() == nets.at(i).source);
+    REQUIRE(path.back() == nets.at(i).target);
+    for (size_t j{1}; j < path.size(); ++j)
+    {
+      REQUIRE(bounds.contains(path.at(j)));
+      REQUIRE(manhattan(path.at(j-1),path.at(j)) == 1);
+    } // for: j
+  } // for: i
+}
+
+// No cell is shared by two paths
+bool disjoint(route::Result const& res)
+{
+  std::set<std::pair<int64_t,int64_t>> used;
+  for (auto const& path : res.paths)
+  {
+    for (auto const& c : path)
+    {
+      if( ! used.insert(c).second ) { return false; }
+    } // for: c
+  } // for: path
+  return true;
+}
+
+//
+// Tests
+//
+
+TEST_CASE("celaeno::graph::route")
+{
+  auto heuristic = [](auto&& p, auto&& t) -> float64_t { return manhattan(p,t); };
+
+  SUBCASE("Independent nets are routed once")
+  {
+    a_star::Bounds bounds{{0,0},{9,9}};
+    std::vector<route::Net> nets { {{0,0},{0,9}}, {{5,0},{5,9}}, {{9,0},{9,9}} };
+    auto res {route::route(bounds, nets, neighbors([](auto&&){ return false; }), heuristic)};
+    check(bounds, nets, res);
+    REQUIRE(res.legal);
+    REQUIRE(res.unrouted.empty());
+    REQUIRE(disjoint(res));
+    REQUIRE(res.iterations == 1);
+    REQUIRE(res.searches == nets.size());
+  } // SUBCASE: Independent nets are routed once
+
+  SUBCASE("Nets negotiate a shared gap")
+  {
+    // A wall on column 5 with gaps on rows 2 and 8, both nets are
+    // closest to the gap on row 2
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto wall = [](auto&& p){ return p.second == 5 && p.first != 2 && p.first != 8; };
+    std::vector<route::Net> nets { {{1,0},{1,9}}, {{3,0},{3,9}}, {{9,0},{9,3}} };
+    auto res {route::route(bounds, nets, neighbors(wall), heuristic)};
+    check(bounds, nets, res);
+    REQUIRE(res.legal);
+    REQUIRE(disjoint(res));
+    REQUIRE(res.iterations > 1);
+    // The net on row 9 does not cross the wall and is not routed again
+    REQUIRE(res.searches < nets.size() * res.iterations);
+  } // SUBCASE: Nets negotiate a shared gap
+
+  SUBCASE("Unresolvable congestion stops at the iteration cap")
+  {
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto wall = [](auto&& p){ return p.second == 5 && p.first != 2; };
+    std::vector<route::Net> nets { {{1,0},{1,9}}, {{3,0},{3,9}} };
+    route::Options options;
+    options.iterations = 8;
+    auto res {route::route(bounds, nets, neighbors(wall), heuristic, options)};
+    check(bounds, nets, res);
+    REQUIRE(! res.legal);
+    REQUIRE(res.iterations == 8);
+  } // SUBCASE: Unresolvable congestion stops at the iteration cap
+
+  SUBCASE("Blocked terminal is reported as unrouted")
+  {
+    // The target of the second net is walled in
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto wall = [](auto&& p){ return manhattan(p,std::make_pair(5,9)) == 1; };
+    std::vector<route::Net> nets { {{0,0},{0,9}}, {{5,0},{5,9}} };
+    auto res {route::route(bounds, nets, neighbors(wall), heuristic)};
+    REQUIRE(! res.legal);
+    REQUIRE(res.unrouted == std::vector<size_t>{1});
+    REQUIRE(res.paths.at(1).empty());
+    REQUIRE(res.paths.at(0).front() == nets.at(0).source);
+    REQUIRE(res.paths.at(0).back() == nets.at(0).target);
+    REQUIRE(res.iterations == 1);
+  } // SUBCASE: Blocked terminal is reported as unrouted
+
+  SUBCASE("Bus fanned out through spread gaps")
+  {
+    // Five adjacent nets must spread over the gaps of a wall on
+    // column 8, all of them start closest to the gap on row 7
+    a_star::Bounds bounds{{0,0},{15,15}};
+    auto wall = [](auto&& p){ return p.second == 8 && p.first % 3 != 1; };
+    std::vector<route::Net> nets;
+    for (int64_t r{5}; r < 10; ++r) { nets.push_back({{r,0},{r,15}}); }
+    auto res {route::route(bounds, nets, neighbors(wall), heuristic)};
+    check(bounds, nets, res);
+    REQUIRE(res.legal);
+    REQUIRE(disjoint(res));
+  } // SUBCASE: Bus fanned out through spread gaps
+
+  SUBCASE("Shared cells within capacity")
+  {
+    a_star::Bounds bounds{{0,0},{9,9}};
+    auto wall = [](auto&& p){ return p.second == 5 && p.first != 2; };
+    std::vector<route::Net> nets { {{1,0},{1,9}}, {{3,0},{3,9}} };
+    route::Options options;
+    options.capacity = 2;
+    auto res {route::route(bounds, nets, neighbors(wall), heuristic, options)};
+    check(bounds, nets, res);
+    REQUIRE(res.legal);
+    REQUIRE(res.iterations == 1);
+  } // SUBCASE: Shared cells within capacity
+
+  SUBCASE("Batch routing")
+  {
+    a_star::Bounds bounds{{0,0},{199,199}};
+    auto blocked = [](auto&& p){ return p.second % 10 == 5 && p.first % 7 != 0; };
+    auto nb {neighbors(blocked)};
+
+    // Short nets scattered over the grid, with a per-cell count of the
+    // cost evaluations of each request
+    std::mt19937 gen{11};
+    std::uniform_int_distribution<int64_t> coord{0,199}, offset{-8,8};
+    std::vector<int32_t> evaluations(bounds.size(), 0);
+    std::vector<route::Request> requests;
+    while( requests.size() < 300 )
+    {
+      std::pair<int64_t,int64_t> s{coord(gen),coord(gen)};
+      std::pair<int64_t,int64_t> t{s.first+offset(gen),s.second+offset(gen)};
+      if( ! bounds.contains(t) || blocked(s) || blocked(t) ) continue;
+      auto weight {1. + static_cast<float64_t>(requests.size() % 3)};
+      requests.push_back({s, t, [&bounds,&evaluations,weight](auto const& c)
+        { ++evaluations[static_cast<size_t>(bounds.index(c))]; return weight; }});
+    } // while
+
+    // Windows of distinct groups never overlap
+    std::vector<a_star::Bounds> windows;
+    for (auto const& r : requests) { windows.push_back(route::window(bounds, r.source, r.target, 2)); }
+    auto groups {route::groups(windows)};
+    std::vector<size_t> group(requests.size());
+    for (size_t g{0}; g < groups.size(); ++g)
+    {
+      REQUIRE(std::ranges::is_sorted(groups.at(g)));
+      for (auto const& i : groups.at(g)) { group.at(i) = g; }
+    } // for: g
+    for (size_t i{0}; i < windows.size(); ++i)
+    {
+      for (size_t j{i+1}; j < windows.size(); ++j)
+      {
+        auto const& [a,b] {std::tie(windows.at(i),windows.at(j))};
+        bool overlap {a.min.first <= b.max.first && b.min.first <= a.max.first
+          && a.min.second <= b.max.second && b.min.second <= a.max.second};
+        if( overlap ) { REQUIRE(group.at(i) == group.at(j)); }
+      } // for: j
+    } // for: i
+
+    // Same paths as the serial searches in each window, for any number
+    // of threads
+    auto serial {route::batch(bounds, requests, nb, heuristic, 2, 1)};
+    for (size_t threads : {2, 8, 32})
+    {
+      REQUIRE(route::batch(bounds, requests, nb, heuristic, 2, threads) == serial);
+    } // for: threads
+
+    for (size_t i{0}; i < requests.size(); ++i)
+    {
+      auto const& r {requests.at(i)};
+      auto h = [&r,&heuristic](auto&& p){ return heuristic(p, r.target); };
+      REQUIRE(serial.at(i) == a_star::a_star(windows.at(i), r.source, r.target, nb, r.f_distance, h));
+      for (auto const& c : serial.at(i)) { REQUIRE(windows.at(i).contains(c)); }
+    } // for: i
+  } // SUBCASE: Batch routing
+
+} // TEST_CASE: celaeno::graph::route
+
+} // namespace celaeno::graph::route::test
@@ -0,0 +1,218 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : depth
+// @created     : Saturday Oct 17, 2026 03:28:56 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/kahn.hpp>
+#include <taygete/graph/graph.hpp>
+#include <taygete/graph/reader.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+#include <unordered_map>
+#include <limits>
+
+namespace celaeno::graph::views::depth::test
+{
+
+//
+// Aliases
+//
+namespace depth = celaeno::graph::views::depth;
+namespace kahn = celaeno::graph::kahn;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Test Wrapper
+//
+template<String T>
+void TEST(T&& str)
+{
+  gra::Graph<int64_t> g;
+  auto emplace = [&g](auto&& pair){ g.emplace(pair); };
+  gra::reader::Reader reader{str,emplace};
+
+  auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
+  auto succ = [&g](auto&& v){ return g.get_successors(v); };
+
+  auto view {depth::flat(int64_t{0},pred,succ)};
+
+  REQUIRE(view.vertices().size() == g.get_node_count());
+
+  // Each vertex is one level below its deepest predecessor
+  for (auto const& v : view.vertices())
+  {
+    int64_t expected{0};
+    for (auto const& p : pred(v)) { expected = std::max(expected, view.level(p)+1); }
+    REQUIRE(view.level(v) == expected);
+  } // for: v
+
+  // Buckets hold the vertices of their level in topological order
+  std::unordered_map<int64_t,size_t> position;
+  auto order {kahn::kahn(int64_t{0},pred,succ)};
+  for (size_t i{0}; i < order.size(); ++i) { position.emplace(order.at(i),i); }
+
+  for (size_t l{0}; l < view.height(); ++l)
+  {
+    auto bucket {view.vertices(static_cast<int64_t>(l))};
+    REQUIRE(! bucket.empty());
+    for (size_t i{0}; i < bucket.size(); ++i)
+    {
+      REQUIRE(view.level(bucket[i]) == static_cast<int64_t>(l));
+      if( i > 0 ) { REQUIRE(position.at(bucket[i-1]) < position.at(bucket[i])); }
+    } // for: i
+  } // for: l
+
+  // The map view holds the same levels
+  auto [level_vertex,vertex_level] = depth::depth(int64_t{0},pred,succ);
+  REQUIRE(vertex_level.size() == view.vertices().size());
+  for (auto const& [v,l] : vertex_level) { REQUIRE(view.level(v) == l); }
+  REQUIRE(level_vertex.size() == vertex_level.size());
+
+  // Ids outside the view
+  REQUIRE(view.level(view.min()-1) == -1);
+  REQUIRE(view.level(view.max()+1) == -1);
+  REQUIRE(view.vertices(static_cast<int64_t>(view.height())).empty());
+
+} // function: TEST
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::views::depth"
+  * doctest::description("Depth view test")
+  * doctest::timeout(10.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::views::depth", "logs/graph-views-depth.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for views/depth.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::views::depth
+
+TEST_CASE("celaeno::graph::views::depth::sparse")
+{
+  // Ids far apart and at both ends of the id type are hashed instead of
+  // spanned by the level array
+  constexpr int64_t lo {std::numeric_limits<int64_t>::min()};
+  constexpr int64_t hi {std::numeric_limits<int64_t>::max()};
+  std::vector<std::pair<int64_t,int64_t>> edges
+    {{0,int64_t{1}<<40},{int64_t{1}<<40,hi},{lo,hi},{lo,0},{-7,lo}};
+  std::unordered_map<int64_t,std::vector<int64_t>> preds, succs;
+  for (auto const& [u,v] : edges) { succs[u].push_back(v); preds[v].push_back(u); }
+  auto pred = [&preds](int64_t v){ return preds[v]; };
+  auto succ = [&succs](int64_t v){ return succs[v]; };
+
+  auto view {depth::flat(int64_t{0},pred,succ)};
+  REQUIRE(view.vertices().size() == 5);
+  CHECK(view.level(-7) == 0);
+  CHECK(view.level(lo) == 1);
+  CHECK(view.level(0) == 2);
+  CHECK(view.level(int64_t{1}<<40) == 3);
+  CHECK(view.level(hi) == 4);
+  CHECK(view.level(1) == -1);
+  CHECK(view.min() == lo);
+  CHECK(view.max() == hi);
+
+  auto [level_vertex,vertex_level] = depth::depth(int64_t{0},pred,succ);
+  REQUIRE(vertex_level.size() == 5);
+  for (auto const& [v,l] : vertex_level) { CHECK(view.level(v) == l); }
+} // TEST_CASE: celaeno::graph::views::depth::sparse
+
+} // namespace celaeno::graph::views::depth::test
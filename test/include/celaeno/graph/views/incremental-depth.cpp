@@ -0,0 +1,309 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : incremental-depth
+// @created     : Saturday Oct 17, 2026 03:31:01 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <map>
+#include <limits>
+#include <vector>
+#include <type_traits>
+#include <celaeno/graph/views/incremental-depth.hpp>
+#include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/balance.hpp>
+#include <taygete/graph/graph.hpp>
+#include <taygete/graph/reader.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+
+namespace celaeno::graph::views::incremental_depth::test
+{
+
+//
+// Aliases
+//
+namespace incremental_depth = celaeno::graph::views::incremental_depth;
+namespace depth = celaeno::graph::views::depth;
+namespace balance = celaeno::graph::balance;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Test Wrapper
+//
+template<String T>
+void TEST(T&& str)
+{
+  gra::Graph<int64_t> g;
+  auto emplace = [&g](auto&& pair){ g.emplace(pair); };
+  gra::reader::Reader reader{str,emplace};
+
+  auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
+  auto succ = [&g](auto&& v){ return g.get_successors(v); };
+  auto link = [&g](auto&& pair){ g.emplace(pair); };
+  auto unlink = [&g](auto&& pair){ g.erase(pair); };
+
+  // Every vertex reachable from the root holds its recomputed level
+  auto check = [&](auto const& view)
+  {
+    auto expected {depth::flat(int64_t{0},pred,succ)};
+    for (auto const& v : expected.vertices())
+    {
+      REQUIRE(view.level(v) == expected.level(v));
+    } // for: v
+    REQUIRE(view.height() == expected.height());
+  };
+
+  auto view {incremental_depth::incremental(int64_t{0},pred,succ)};
+  auto [tracked_link,tracked_unlink] {view.subscribe(link,unlink)};
+
+  // Balance edits the graph through the view
+  balance::balance(int64_t{0},pred,succ,tracked_link,tracked_unlink);
+  check(view);
+  REQUIRE(view.rebuilds() == 1);
+
+  // Forward edges that lengthen paths, between consecutive topological levels
+  auto snapshot {depth::flat(int64_t{0},pred,succ)};
+  auto height {static_cast<int64_t>(snapshot.height())};
+  for (int64_t l{0}; l+2 < height; l += 3)
+  {
+    auto from {snapshot.vertices(l)};
+    auto to {snapshot.vertices(l+2)};
+    tracked_link(std::make_pair(from.front(),to.back()));
+    check(view);
+  } // for: l
+
+  // Remove the edges into a few vertices and put them back
+  for (int64_t l{1}; l < height; l += 4)
+  {
+    auto v {snapshot.vertices(l).front()};
+    auto preds {pred(v)};
+    for (auto const& p : preds) { tracked_unlink(std::make_pair(p,v)); }
+    for (auto const& p : preds) { tracked_link(std::make_pair(p,v)); }
+    check(view);
+  } // for: l
+
+  // An edge that closes a cycle falls back to a full rebuild
+  if( height > 1 )
+  {
+    auto rebuilds {view.rebuilds()};
+    auto v {snapshot.vertices(height-1).front()};
+    auto p {pred(v).front()};
+    tracked_link(std::make_pair(v,p));
+    REQUIRE(view.rebuilds() > rebuilds);
+    check(view);
+  } // if
+
+} // function: TEST
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::views::incremental_depth"
+  * doctest::description("Incremental depth view test")
+  * doctest::timeout(100.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::views::incremental_depth", "logs/graph-views-incremental-depth.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::b1);
+  TEST(cir::synth_91::c8);
+  TEST(cir::synth_91::cc);
+  TEST(cir::synth_91::cht);
+  TEST(cir::synth_91::cm138a);
+  TEST(cir::synth_91::cm150a);
+  TEST(cir::synth_91::cm151a);
+  TEST(cir::synth_91::cm162a);
+  TEST(cir::synth_91::cm163a);
+  TEST(cir::synth_91::cm42a);
+  TEST(cir::synth_91::cm82a);
+  TEST(cir::synth_91::cm85a);
+  TEST(cir::synth_91::cmb);
+  TEST(cir::synth_91::comp);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::cu);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::decod);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for views/incremental-depth.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::views::incremental_depth
+
+TEST_CASE("celaeno::graph::views::incremental_depth::sparse")
+{
+  // Ids far apart, the rebuild after a cycle goes through depth::flat
+  std::map<int64_t,std::vector<int64_t>> preds, succs;
+  auto pred = [&preds](int64_t v){ return preds[v]; };
+  auto succ = [&succs](int64_t v){ return succs[v]; };
+  auto link = [&](auto&& e){ succs[e.first].push_back(e.second); preds[e.second].push_back(e.first); };
+  auto unlink = [&](auto&& e)
+  {
+    std::erase(succs[e.first], e.second);
+    std::erase(preds[e.second], e.first);
+  };
+
+  constexpr int64_t far {int64_t{1}<<40};
+  link(std::make_pair(int64_t{0},far));
+  link(std::make_pair(far,std::numeric_limits<int64_t>::max()));
+
+  auto view {incremental_depth::incremental(int64_t{0},pred,succ)};
+  static_assert(! std::is_move_constructible_v<decltype(view)>);
+  static_assert(! std::is_copy_constructible_v<decltype(view)>);
+  auto tracked_link {view.subscribe(link,unlink).first};
+  CHECK(view.level(far) == 1);
+  CHECK(view.level(std::numeric_limits<int64_t>::max()) == 2);
+
+  tracked_link(std::make_pair(std::numeric_limits<int64_t>::min(),int64_t{0}));
+  CHECK(view.level(int64_t{0}) == 1);
+  CHECK(view.level(std::numeric_limits<int64_t>::max()) == 3);
+
+  // Close a cycle through the far vertex, its members leave the view
+  auto rebuilds {view.rebuilds()};
+  tracked_link(std::make_pair(far,int64_t{0}));
+  CHECK(view.rebuilds() > rebuilds);
+  CHECK(view.level(std::numeric_limits<int64_t>::min()) == 0);
+  CHECK(view.level(far) == -1);
+} // TEST_CASE: celaeno::graph::views::incremental_depth::sparse
+
+TEST_CASE("celaeno::graph::views::incremental_depth::components")
+{
+  // Links that join a separate component to the view
+  std::map<int64_t,std::vector<int64_t>> preds, succs;
+  auto pred = [&preds](int64_t v){ return preds[v]; };
+  auto succ = [&succs](int64_t v){ return succs[v]; };
+  auto link = [&](auto&& e){ succs[e.first].push_back(e.second); preds[e.second].push_back(e.first); };
+  auto unlink = [&](auto&& e)
+  {
+    std::erase(succs[e.first], e.second);
+    std::erase(preds[e.second], e.first);
+  };
+  auto edge = [](int64_t u, int64_t v){ return std::make_pair(u,v); };
+
+  auto check = [&](auto const& view)
+  {
+    auto expected {depth::flat(int64_t{0},pred,succ)};
+    for (auto const& v : expected.vertices())
+    {
+      REQUIRE(view.level(v) == expected.level(v));
+    } // for: v
+    REQUIRE(view.size() == expected.vertices().size());
+    REQUIRE(view.height() == expected.height());
+  };
+
+  SUBCASE("successors outside the view")
+  {
+    link(edge(0,1));
+    link(edge(2,3));
+    auto view {incremental_depth::incremental(int64_t{0},pred,succ)};
+    auto [tracked_link,tracked_unlink] {view.subscribe(link,unlink)};
+    tracked_link(edge(1,2));
+    check(view);
+    CHECK(view.level(3) == 3);
+  } // SUBCASE
+
+  SUBCASE("endpoint level unchanged")
+  {
+    for (auto const& [u,v] : {edge(0,3),edge(0,4),edge(1,2),edge(1,5),edge(2,5)})
+    {
+      link(edge(u,v));
+    } // for: u,v
+    auto view {incremental_depth::incremental(int64_t{0},pred,succ)};
+    auto [tracked_link,tracked_unlink] {view.subscribe(link,unlink)};
+    tracked_unlink(edge(1,5));
+    tracked_unlink(edge(0,4));
+    tracked_link(edge(1,3));
+    check(view);
+    CHECK(view.level(2) == 1);
+    CHECK(view.level(5) == 2);
+  } // SUBCASE
+
+  SUBCASE("predecessors outside the view")
+  {
+    link(edge(0,1));
+    link(edge(2,3));
+    link(edge(4,3));
+    link(edge(5,4));
+    auto view {incremental_depth::incremental(int64_t{0},pred,succ)};
+    auto [tracked_link,tracked_unlink] {view.subscribe(link,unlink)};
+    tracked_link(edge(3,0));
+    check(view);
+    CHECK(view.level(1) == 4);
+  } // SUBCASE
+} // TEST_CASE: celaeno::graph::views::incremental_depth::components
+
+} // namespace celaeno::graph::views::incremental_depth::test
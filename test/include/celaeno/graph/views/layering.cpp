@@ -0,0 +1,305 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : layering
+// @created     : Saturday Oct 17, 2026 04:24:41 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <map>
+#include <random>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <celaeno/graph/views/layering.hpp>
+#include <celaeno/graph/views/depth.hpp>
+#include <celaeno/graph/balance.hpp>
+#include <celaeno/graph/csr.hpp>
+#include <taygete/graph/graph.hpp>
+#include <taygete/graph/reader.hpp>
+#include <maia/circuits/iscas.hpp>
+#include <maia/circuits/synth-91.hpp>
+
+namespace celaeno::graph::views::layering::test
+{
+
+//
+// Aliases
+//
+namespace layering = celaeno::graph::views::layering;
+namespace depth = celaeno::graph::views::depth;
+namespace balance = celaeno::graph::balance;
+namespace csr = celaeno::graph::csr;
+namespace cir = maia::circuits;
+namespace gra = taygete::graph;
+using float64_t = double;
+
+//
+// Concepts
+//
+
+template<typename T>
+concept String = requires(T t){ std::string{t}; };
+
+//
+// Helpers
+//
+
+// The layering covers the same vertices, keeps sources on level 0 and
+// every edge pointing at least one level down
+template<typename F>
+void CHECK_VALID(depth::Flat<int64_t> const& view, depth::Flat<int64_t> const& layers, F&& pred)
+{
+  REQUIRE(layers.vertices().size() == view.vertices().size());
+  REQUIRE(layers.min() == view.min());
+  for (auto const& v : view.vertices())
+  {
+    REQUIRE(layers.level(v) >= 0);
+    if( view.level(v) == 0 ) { REQUIRE(layers.level(v) == 0); }
+    for (auto const& p : pred(v)) { REQUIRE(layers.level(v) > layers.level(p)); }
+  } // for: v
+
+  for (size_t l{0}; l < layers.height(); ++l)
+  {
+    for (auto const& v : layers.vertices(static_cast<int64_t>(l)))
+    {
+      REQUIRE(layers.level(v) == static_cast<int64_t>(l));
+    } // for: v
+  } // for: l
+} // function: CHECK_VALID
+
+//
+// Test Wrapper
+//
+template<String T>
+void TEST(T&& str)
+{
+  gra::Graph<int64_t> g;
+  auto emplace = [&g](auto&& pair){ g.emplace(pair); };
+  gra::reader::Reader reader{str,emplace};
+
+  auto pred = [&g](auto&& v){ return g.get_predecessors(v); };
+  auto succ = [&g](auto&& v){ return g.get_successors(v); };
+
+  auto view {depth::flat(int64_t{0},pred,succ)};
+  auto layers {layering::simplex(view,pred)};
+  CHECK_VALID(view, layers, pred);
+
+  // Never longer than the longest-path layering, nor more pseudo vertices
+  CHECK(layering::span(layers,pred) <= layering::span(view,pred));
+  CHECK(balance::plan(layers,pred).pseudo() <= balance::plan(view,pred).pseudo());
+} // function: TEST
+
+//
+// Test Cases
+//
+
+TEST_CASE("celaeno::graph::views::layering"
+  * doctest::description("Network simplex layering test")
+  * doctest::timeout(100.0f)
+)
+{
+  //
+  // Logger
+  //
+
+  auto logger {spdlog::basic_logger_mt("graph::views::layering", "logs/graph-views-layering.txt")};
+  spdlog::set_default_logger(logger);
+  auto start {std::chrono::system_clock::now()};
+
+  //
+  // Iscas
+  //
+
+  TEST(cir::iscas::s27);
+  TEST(cir::iscas::s298);
+  TEST(cir::iscas::s349);
+  TEST(cir::iscas::s208);
+  TEST(cir::iscas::s420);
+  TEST(cir::iscas::s838);
+  TEST(cir::iscas::s386);
+  TEST(cir::iscas::s510);
+  TEST(cir::iscas::s1494);
+  TEST(cir::iscas::s832);
+
+  //
+  // LGSynth 91
+  //
+  TEST(cir::synth_91::alu2);
+  TEST(cir::synth_91::alu4);
+  TEST(cir::synth_91::dalu);
+  TEST(cir::synth_91::apex6);
+  TEST(cir::synth_91::apex7);
+  TEST(cir::synth_91::cordic);
+  TEST(cir::synth_91::count);
+  TEST(cir::synth_91::my_adder);
+
+  //
+  // Log duration
+  //
+
+  auto end {std::chrono::system_clock::now()};
+  std::chrono::duration<float64_t> dur {end-start};
+  std::stringstream ss; ss << dur.count();
+  spdlog::info("Duration for views/layering.cpp: {}", ss.str());
+
+} // TEST_CASE: celaeno::graph::views::layering
+
+TEST_CASE("celaeno::graph::views::layering::optimal")
+{
+  // Small random DAGs over ids in topological order, compared against every
+  // layering that keeps the sources on level 0
+  std::mt19937 gen{7};
+  std::bernoulli_distribution coin{0.35};
+  int32_t checked{0};
+
+  for (int32_t round{0}; round < 200; ++round)
+  {
+    int64_t n {std::uniform_int_distribution<int64_t>{2,7}(gen)};
+    std::vector<std::pair<int64_t,int64_t>> edges;
+    for (int64_t v{1}; v < n; ++v)
+    {
+      for (int64_t u{0}; u < v; ++u)
+      {
+        if( coin(gen) ) { edges.emplace_back(u,v); }
+      } // for: u
+    } // for: v
+    if( edges.empty() ) continue;
+    csr::Graph<int64_t> g{edges};
+    auto pred = [&g](auto&& v){ return g.pred(v); };
+    auto succ = [&g](auto&& v){ return g.succ(v); };
+
+    auto view {depth::flat(int64_t{0},pred,succ)};
+    if( view.vertices().size() != static_cast<size_t>(n) ) continue;
+    ++checked;
+
+    // Exhaustive search, levels assigned in id order
+    std::vector<int64_t> level(static_cast<size_t>(n));
+    int64_t best {std::numeric_limits<int64_t>::max()};
+    std::function<void(int64_t)> search = [&](int64_t v)
+    {
+      if( v == n )
+      {
+        int64_t total{0};
+        for (auto const& [p,s] : edges) { total += level[static_cast<size_t>(s)] - level[static_cast<size_t>(p)]; }
+        best = std::min(best, total);
+        return;
+      } // if
+      int64_t low{0};
+      for (auto const& p : pred(v)) { low = std::max(low, level[static_cast<size_t>(p)]+1); }
+      auto high {(view.level(v) == 0)? int64_t{0} : n};
+      for (level[static_cast<size_t>(v)] = low; level[static_cast<size_t>(v)] <= high; ++level[static_cast<size_t>(v)]) { search(v+1); }
+    };
+    search(0);
+
+    auto layers {layering::simplex(int64_t{0},pred,succ)};
+    CHECK_VALID(view, layers, pred);
+    REQUIRE(layering::span(layers,pred) == best);
+  } // for: round
+
+  CHECK(checked > 50);
+} // TEST_CASE: celaeno::graph::views::layering::optimal
+
+TEST_CASE("celaeno::graph::views::layering::balance")
+{
+  //
+  // 0 -> 1 -> 2 -> 3 -> 4
+  //                ^    ^
+  //      5 -> 6 ---/----/
+  //
+  // The longest path puts 6 on level 1, so both of its edges need pseudo
+  // vertices. The simplex lifts 6 to level 2, one chain feeds 6 and another
+  // feeds 4, and 5 stays pinned as a source.
+  //
+  std::vector<std::pair<int64_t,int64_t>> edges {{0,1},{1,2},{2,3},{3,4},{5,6},{6,3},{6,4}};
+  csr::Graph<int64_t> g{edges};
+  auto pred = [&g](auto&& v){ return g.pred(v); };
+  auto succ = [&g](auto&& v){ return g.succ(v); };
+
+  auto view {depth::flat(int64_t{0},pred,succ)};
+  auto layers {layering::simplex(view,pred)};
+  CHECK_VALID(view, layers, pred);
+  CHECK(layers.level(5) == 0);
+  CHECK(layers.level(6) == 2);
+  CHECK(layering::span(view,pred) == 10);
+  CHECK(layering::span(layers,pred) == 9);
+
+  auto longest {balance::plan(view,pred)};
+  auto plan {balance::plan(layers,pred)};
+  CHECK(longest.pseudo() == 3);
+  REQUIRE(plan.pseudo() == 2);
+  REQUIRE(plan.chains.size() == 2);
+  CHECK(plan.chains[0].source == 5);
+  CHECK(plan.chains[0].target == 6);
+  CHECK(plan.chains[1].source == 6);
+  CHECK(plan.chains[1].target == 4);
+
+  // The balanced graph has every edge one level long, and its flat depth
+  // matches the layering on the original vertices
+  auto balanced {balance::expand(plan, edges)};
+  REQUIRE(balanced.size() == edges.size() + static_cast<size_t>(plan.pseudo()));
+  for (auto& [u,v] : balanced) { u -= plan.min(); v -= plan.min(); }
+  csr::Graph<int64_t> h{balanced};
+  auto hpred = [&h](auto&& v){ return h.pred(v); };
+  auto hview {depth::flat(-plan.min(), hpred, [&h](auto&& v){ return h.succ(v); })};
+  for (auto const& v : hview.vertices())
+  {
+    for (auto const& p : hpred(v)) { REQUIRE(hview.level(v) == hview.level(p)+1); }
+  } // for: v
+  for (int64_t v{0}; v < 7; ++v) { CHECK(hview.level(v - plan.min()) == layers.level(v)); }
+} // TEST_CASE: celaeno::graph::views::layering::balance
+
+TEST_CASE("celaeno::graph::views::layering::sparse")
+{
+  // Ids far apart, scaled copy of the balance example above plus a source
+  // feeding the deepest vertex, whose edge the pinned sources keep long
+  constexpr int64_t far {int64_t{1}<<40};
+  std::vector<std::pair<int64_t,int64_t>> edges {{0,1},{1,2},{2,3},{3,4},{5,6},{6,3},{6,4},{7,4}};
+  std::map<int64_t,std::vector<int64_t>> preds, succs;
+  for (auto const& [u,v] : edges)
+  {
+    succs[u*far].push_back(v*far);
+    preds[v*far].push_back(u*far);
+  } // for: edges
+  auto pred = [&preds](int64_t v){ return preds[v]; };
+  auto succ = [&succs](int64_t v){ return succs[v]; };
+
+  auto view {depth::flat(int64_t{0},pred,succ)};
+  auto layers {layering::simplex(view,pred)};
+  REQUIRE(layers.vertices().size() == 8);
+  CHECK(layers.level(6*far) == 2);
+  CHECK(layers.level(7*far) == 0);
+  CHECK(layers.level(4*far) == 4);
+  CHECK(layering::span(view,pred) == 14);
+  CHECK(layering::span(layers,pred) == 13);
+} // TEST_CASE: celaeno::graph::views::layering::sparse
+
+} // namespace celaeno::graph::views::layering::test
@@ -0,0 +1,107 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : visited
+// @created     : Saturday Oct 17, 2026 03:19:06 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/graph/visited.hpp>
+#include <limits>
+#include <set>
+
+namespace celaeno::graph::visited::test
+{
+
+//
+// Aliases
+//
+
+namespace visited = celaeno::graph::visited;
+
+//
+// Helpers
+//
+
+// Inserts a pseudo-random sequence of ids, comparing against std::set
+template<typename V>
+void compare(V&& v, int64_t lo, int64_t hi)
+{
+  std::set<int64_t> reference;
+  uint64_t state{42};
+  for (int32_t i{0}; i < 10000; ++i)
+  {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    auto id {lo + static_cast<int64_t>((state >> 33) % static_cast<uint64_t>(hi-lo))};
+    REQUIRE(v.contains(id) == reference.contains(id));
+    REQUIRE(v.insert(id) == reference.insert(id).second);
+  } // for: i
+  v.clear();
+  for (auto const& id : reference) { REQUIRE(! v.contains(id)); }
+} // function: compare
+
+//
+// Tests
+//
+
+TEST_CASE("celaeno::graph::visited")
+{
+  SUBCASE("Bitset")
+  {
+    compare(visited::Bitset<int64_t>{}, 0, 5000);
+    compare(visited::Bitset<int64_t>{5000}, 0, 5000);
+    // Negative ids, as balance numbers its pseudo vertices
+    compare(visited::Bitset<int64_t>{}, -2500, 2500);
+    visited::Bitset<int64_t> b;
+    REQUIRE(b.insert(-1));
+    REQUIRE(! b.contains(0));
+    REQUIRE(b.insert(0));
+    REQUIRE(! b.insert(-1));
+  } // SUBCASE: "Bitset"
+
+  SUBCASE("Hash")
+  {
+    compare(visited::Hash<int64_t>{}, -2500, 2500);
+    visited::Hash<int64_t> h;
+    auto min {std::numeric_limits<int64_t>::min()};
+    REQUIRE(! h.contains(min));
+    REQUIRE(h.insert(min));
+    REQUIRE(h.contains(min));
+    REQUIRE(! h.insert(min));
+  } // SUBCASE: "Hash"
+
+  SUBCASE("Stamp")
+  {
+    visited::Stamp<int64_t> workspace;
+    for (int32_t i{0}; i < 100; ++i) { compare(workspace, 0, 5000); }
+    for (int32_t i{0}; i < 100; ++i) { compare(workspace, -2500, 2500); }
+  } // SUBCASE: "Stamp"
+
+} // TEST_CASE: "celaeno::graph::visited"
+
+} // namespace celaeno::graph::visited::test
@@ -0,0 +1,145 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : cantor-pairing
+// @created     : Saturday Oct 17, 2026 03:54:38 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/math/cantor-pairing.hpp>
+
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace celaeno::math::cantor_pairing::test
+{
+
+//
+// Aliases
+//
+namespace cantor_pairing = celaeno::math::cantor_pairing;
+
+//
+// Tests
+//
+
+static_assert(cantor_pairing::pair(0,0) == 0);
+static_assert(cantor_pairing::pair(1,0) == 1);
+static_assert(cantor_pairing::pair(0,1) == 2);
+static_assert(cantor_pairing::pair(47,32) == 3192);
+static_assert(cantor_pairing::unpair(3192) == std::pair<uint64_t,uint64_t>{47,32});
+static_assert(cantor_pairing::fits(cantor_pairing::max_sum,0));
+static_assert(cantor_pairing::fits(3327948884,2746052115));
+static_assert(! cantor_pairing::fits(3327948883,2746052116));
+static_assert(! cantor_pairing::fits(0,cantor_pairing::max_sum));
+static_assert(! cantor_pairing::fits(cantor_pairing::max_sum+1,0));
+static_assert(! cantor_pairing::fits(UINT64_MAX,UINT64_MAX));
+static_assert(cantor_pairing::pair(cantor_pairing::max_sum,0) == cantor_pairing::triangular(cantor_pairing::max_sum));
+static_assert(cantor_pairing::pair(3327948884,2746052115) == UINT64_MAX);
+static_assert(cantor_pairing::unpair(UINT64_MAX) == std::pair<uint64_t,uint64_t>{3327948884,2746052115});
+
+TEST_CASE("celaeno::math::cantor_pairing")
+{
+  SUBCASE("Enumerates the diagonals")
+  {
+    uint64_t z{0};
+    for (uint64_t s{0}; s < 64; ++s)
+    {
+      for (uint64_t k2{0}; k2 <= s; ++k2)
+      {
+        CHECK(cantor_pairing::pair(s-k2, k2) == z);
+        CHECK(cantor_pairing::unpair(z) == std::make_pair(s-k2, k2));
+        ++z;
+      } // for: k2
+    } // for: s
+  } // SUBCASE: Enumerates the diagonals
+
+  SUBCASE("Exact beyond double precision")
+  {
+    std::mt19937_64 gen{3};
+    std::uniform_int_distribution<uint64_t> dist{0, 3037000000};
+    for (int32_t i{0}; i < 100000; ++i)
+    {
+      uint64_t k1{dist(gen)}, k2{dist(gen)};
+      auto z {cantor_pairing::pair(k1,k2)};
+      CHECK(cantor_pairing::unpair(z) == std::make_pair(k1,k2));
+      CHECK(z == static_cast<uint64_t>(cantor_pairing::triangular(k1+k2)) + k2);
+    } // for: i
+
+    // Keys near the top of the range
+    for (uint64_t z{UINT64_MAX}; z > UINT64_MAX - 100000; --z)
+    {
+      auto [k1,k2] {cantor_pairing::unpair(z)};
+      CHECK(cantor_pairing::pair(k1,k2) == z);
+    } // for: z
+  } // SUBCASE: Exact beyond double precision
+
+  SUBCASE("Batched kernels")
+  {
+    std::mt19937_64 gen{4};
+    std::uniform_int_distribution<uint64_t> dist{0, uint64_t{1} << 31};
+    std::vector<uint64_t> k1(1027), k2(1027), z(1027), r1(1027), r2(1027);
+    for (size_t i{0}; i < k1.size(); ++i) { k1[i] = dist(gen); k2[i] = dist(gen); }
+
+    cantor_pairing::pair(k1, k2, z);
+    cantor_pairing::unpair(z, r1, r2);
+    for (size_t i{0}; i < k1.size(); ++i) { CHECK(z[i] == cantor_pairing::pair(k1[i],k2[i])); }
+    CHECK(r1 == k1);
+    CHECK(r2 == k2);
+  } // SUBCASE: Batched kernels
+
+  SUBCASE("Generic interface")
+  {
+    // Doubles, as the closed form always returned
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(int64_t{47},int64_t{32})) == 3192.);
+    CHECK(cantor_pairing::cantor_pairing(int64_t{3192}) == std::make_pair(47.,32.));
+    CHECK(cantor_pairing::cantor_pairing(3192.) == std::make_pair(47.,32.));
+    static_assert(std::is_same_v<decltype(cantor_pairing::cantor_pairing(std::make_pair(1,2))), double>);
+    static_assert(std::is_same_v<decltype(cantor_pairing::cantor_pairing(int32_t{3})), std::pair<double,double>>);
+
+    // No narrowing to the input type
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(50000,50000)) == 5000100000.);
+
+    // Keys past 64 bits keep the closed form instead of wrapping
+    auto s {static_cast<int64_t>(cantor_pairing::max_sum)};
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(s,int64_t{0}))
+      == static_cast<double>(cantor_pairing::pair(cantor_pairing::max_sum,0)));
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(s+1,int64_t{0})) == .5*(s+1)*(s+2));
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(int64_t{0},s)) == .5*s*(s+1)+s);
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(s,s)) == .5*(2*s)*(2*s+1)+s);
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(s+1,int64_t{0}))
+      == doctest::Approx(static_cast<double>(cantor_pairing::triangular(cantor_pairing::max_sum+1))));
+
+    // Negative inputs keep the closed form
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(-3,1)) == .5*(-2)*(-1)+1);
+    CHECK(cantor_pairing::cantor_pairing(std::make_pair(-3,1)) == cantor_pairing::cantor_pairing(std::make_pair(-3.,1.)));
+  } // SUBCASE: Generic interface
+} // TEST_CASE: celaeno::math::cantor_pairing
+
+} // namespace celaeno::math::cantor_pairing::test
@@ -0,0 +1,94 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : hilbert
+// @created     : Saturday Oct 17, 2026 04:00:47 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/math/hilbert.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace celaeno::math::hilbert::test
+{
+
+//
+// Aliases
+//
+namespace hilbert = celaeno::math::hilbert;
+
+//
+// Tests
+//
+
+static_assert(hilbert::encode(0,0,1) == 0);
+static_assert(hilbert::encode(0,1,1) == 1);
+static_assert(hilbert::encode(1,1,1) == 2);
+static_assert(hilbert::encode(1,0,1) == 3);
+static_assert(hilbert::decode(2,1) == std::pair<uint32_t,uint32_t>{1,1});
+
+TEST_CASE("celaeno::math::hilbert")
+{
+  SUBCASE("Consecutive positions are adjacent cells")
+  {
+    for (uint32_t order{0}; order < 8; ++order)
+    {
+      uint64_t cells {uint64_t{1} << (2*order)};
+      std::vector<bool> seen(cells, false);
+      for (uint64_t d{0}; d < cells; ++d)
+      {
+        auto [x,y] {hilbert::decode(d,order)};
+        REQUIRE(x < (1u << order));
+        REQUIRE(y < (1u << order));
+        CHECK(hilbert::encode(x,y,order) == d);
+        CHECK(! seen[(uint64_t{y} << order) | x]);
+        seen[(uint64_t{y} << order) | x] = true;
+        if( d == 0 ) continue;
+        auto [px,py] {hilbert::decode(d-1,order)};
+        CHECK(std::abs(int64_t{x}-int64_t{px}) + std::abs(int64_t{y}-int64_t{py}) == 1);
+      } // for: d
+    } // for: order
+  } // SUBCASE: Consecutive positions are adjacent cells
+
+  SUBCASE("Full order")
+  {
+    std::mt19937_64 gen{9};
+    std::uniform_int_distribution<uint32_t> dist{0, UINT32_MAX};
+    for (int32_t i{0}; i < 10000; ++i)
+    {
+      uint32_t x{dist(gen)}, y{dist(gen)};
+      CHECK(hilbert::decode(hilbert::encode(x,y,32),32) == std::make_pair(x,y));
+    } // for: i
+  } // SUBCASE: Full order
+} // TEST_CASE: celaeno::math::hilbert
+
+} // namespace celaeno::math::hilbert::test
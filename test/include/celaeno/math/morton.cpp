@@ -0,0 +1,117 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : morton
+// @created     : Saturday Oct 17, 2026 03:53:52 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/math/morton.hpp>
+
+#include <random>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+namespace celaeno::math::morton::test
+{
+
+//
+// Aliases
+//
+namespace morton = celaeno::math::morton;
+
+//
+// Tests
+//
+
+static_assert(morton::encode(0,0) == 0);
+static_assert(morton::encode(1,0) == 1);
+static_assert(morton::encode(0,1) == 2);
+static_assert(morton::encode(3,5) == 0b100111);
+static_assert(morton::encode(UINT32_MAX,UINT32_MAX) == UINT64_MAX);
+static_assert(morton::decode(0b100111) == std::pair<uint32_t,uint32_t>{3,5});
+
+TEST_CASE("celaeno::math::morton")
+{
+  SUBCASE("Bit interleaving")
+  {
+    std::mt19937_64 gen{7};
+    std::uniform_int_distribution<uint32_t> dist{0, UINT32_MAX};
+    for (int32_t i{0}; i < 100000; ++i)
+    {
+      uint32_t x{dist(gen)}, y{dist(gen)};
+      auto z {morton::encode(x,y)};
+      for (uint32_t b{0}; b < 32; ++b)
+      {
+        CHECK(((z >> (2*b)) & 1) == ((x >> b) & 1));
+        CHECK(((z >> (2*b+1)) & 1) == ((y >> b) & 1));
+      } // for: b
+      CHECK(morton::decode(z) == std::make_pair(x,y));
+    } // for: i
+  } // SUBCASE: Bit interleaving
+
+  SUBCASE("Quadrants are contiguous")
+  {
+    // Each aligned 2^k block of the grid covers a contiguous run of keys
+    for (uint32_t k{1}; k < 5; ++k)
+    {
+      uint32_t side {1u << k};
+      for (uint32_t bx{0}; bx < 4; ++bx)
+      {
+        for (uint32_t by{0}; by < 4; ++by)
+        {
+          std::vector<uint64_t> keys;
+          for (uint32_t x{bx*side}; x < (bx+1)*side; ++x)
+          {
+            for (uint32_t y{by*side}; y < (by+1)*side; ++y) { keys.push_back(morton::encode(x,y)); }
+          } // for: x
+          auto [lo,hi] {std::minmax_element(keys.begin(), keys.end())};
+          CHECK(*hi - *lo + 1 == keys.size());
+        } // for: by
+      } // for: bx
+    } // for: k
+  } // SUBCASE: Quadrants are contiguous
+
+  SUBCASE("Batched kernels")
+  {
+    std::mt19937_64 gen{8};
+    std::uniform_int_distribution<uint32_t> dist{0, UINT32_MAX};
+    std::vector<uint32_t> x(1027), y(1027), rx(1027), ry(1027);
+    std::vector<uint64_t> z(1027);
+    for (size_t i{0}; i < x.size(); ++i) { x[i] = dist(gen); y[i] = dist(gen); }
+
+    morton::encode(x, y, z);
+    morton::decode(z, rx, ry);
+    for (size_t i{0}; i < x.size(); ++i) { CHECK(z[i] == morton::encode(x[i],y[i])); }
+    CHECK(rx == x);
+    CHECK(ry == y);
+  } // SUBCASE: Batched kernels
+} // TEST_CASE: celaeno::math::morton
+
+} // namespace celaeno::math::morton::test
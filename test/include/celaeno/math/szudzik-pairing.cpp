@@ -0,0 +1,105 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : szudzik-pairing
+// @created     : Saturday Oct 17, 2026 03:53:54 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/math/szudzik-pairing.hpp>
+
+#include <random>
+#include <vector>
+#include <utility>
+
+namespace celaeno::math::szudzik_pairing::test
+{
+
+//
+// Aliases
+//
+namespace szudzik_pairing = celaeno::math::szudzik_pairing;
+
+//
+// Tests
+//
+
+static_assert(szudzik_pairing::pair(0,0) == 0);
+static_assert(szudzik_pairing::pair(0,1) == 1);
+static_assert(szudzik_pairing::pair(1,0) == 2);
+static_assert(szudzik_pairing::pair(1,1) == 3);
+static_assert(szudzik_pairing::pair(UINT32_MAX,UINT32_MAX) == UINT64_MAX);
+static_assert(szudzik_pairing::unpair(UINT64_MAX) == std::pair<uint32_t,uint32_t>{UINT32_MAX,UINT32_MAX});
+static_assert(szudzik_pairing::isqrt(UINT64_MAX) == UINT32_MAX);
+
+TEST_CASE("celaeno::math::szudzik_pairing")
+{
+  SUBCASE("Enumerates the shells")
+  {
+    uint64_t z{0};
+    for (uint32_t s{0}; s < 64; ++s)
+    {
+      for (uint32_t x{0}; x < s; ++x) { CHECK(szudzik_pairing::unpair(z++) == std::make_pair(x,s)); }
+      for (uint32_t y{0}; y <= s; ++y) { CHECK(szudzik_pairing::unpair(z++) == std::make_pair(s,y)); }
+    } // for: s
+  } // SUBCASE: Enumerates the shells
+
+  SUBCASE("Exact over the whole range")
+  {
+    std::mt19937_64 gen{5};
+    std::uniform_int_distribution<uint32_t> dist{0, UINT32_MAX};
+    for (int32_t i{0}; i < 100000; ++i)
+    {
+      uint32_t x{dist(gen)}, y{dist(gen)};
+      CHECK(szudzik_pairing::unpair(szudzik_pairing::pair(x,y)) == std::make_pair(x,y));
+    } // for: i
+
+    for (uint64_t z{UINT64_MAX}; z > UINT64_MAX - 100000; --z)
+    {
+      auto [x,y] {szudzik_pairing::unpair(z)};
+      CHECK(szudzik_pairing::pair(x,y) == z);
+    } // for: z
+  } // SUBCASE: Exact over the whole range
+
+  SUBCASE("Batched kernels")
+  {
+    std::mt19937_64 gen{6};
+    std::uniform_int_distribution<uint32_t> dist{0, UINT32_MAX};
+    std::vector<uint32_t> x(1027), y(1027), rx(1027), ry(1027);
+    std::vector<uint64_t> z(1027);
+    for (size_t i{0}; i < x.size(); ++i) { x[i] = dist(gen); y[i] = dist(gen); }
+
+    szudzik_pairing::pair(x, y, z);
+    szudzik_pairing::unpair(z, rx, ry);
+    for (size_t i{0}; i < x.size(); ++i) { CHECK(z[i] == szudzik_pairing::pair(x[i],y[i])); }
+    CHECK(rx == x);
+    CHECK(ry == y);
+  } // SUBCASE: Batched kernels
+} // TEST_CASE: celaeno::math::szudzik_pairing
+
+} // namespace celaeno::math::szudzik_pairing::test
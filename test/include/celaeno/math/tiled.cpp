@@ -0,0 +1,178 @@
+//
+// @author      : Ruan E. Formigoni (ruanformigoni@gmail.com)
+// @file        : tiled
+// @created     : Saturday Oct 17, 2026 04:01:06 -03
+//
+// BSD 2-Clause License
+
+// Copyright (c) 2020, Ruan Evangelista Formigoni
+// All rights reserved.
+
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+#include <celaeno/math/tiled.hpp>
+
+#include <set>
+#include <cstdlib>
+#include <vector>
+#include <limits>
+#include <utility>
+
+namespace celaeno::math::tiled::test
+{
+
+//
+// Aliases
+//
+namespace tiled = celaeno::math::tiled;
+using Cell = std::pair<int64_t,int64_t>;
+
+//
+// Tests
+//
+
+TEST_CASE("celaeno::math::tiled")
+{
+  SUBCASE("Layouts number every cell once")
+  {
+    for (auto curve : {tiled::Curve::hilbert, tiled::Curve::morton})
+    {
+      for (int32_t log : {0, 1, 3, 4})
+      {
+        tiled::Layout layout{{-5,7},{17,30}, curve, log};
+        CHECK(layout.rows() == 23);
+        CHECK(layout.cols() == 24);
+        CHECK(layout.size() >= static_cast<size_t>(layout.rows() * layout.cols()));
+
+        std::vector<bool> seen(layout.size(), false);
+        for (int64_t r{layout.min().first}; r <= layout.max().first; ++r)
+        {
+          for (int64_t c{layout.min().second}; c <= layout.max().second; ++c)
+          {
+            auto i {layout.index(Cell{r,c})};
+            REQUIRE(i >= 0);
+            REQUIRE(static_cast<size_t>(i) < layout.size());
+            CHECK(! seen[static_cast<size_t>(i)]);
+            seen[static_cast<size_t>(i)] = true;
+            CHECK((layout.cell(i) == Cell{r,c}));
+          } // for: c
+        } // for: r
+
+        // Padding slots map outside the rectangle
+        for (size_t i{0}; i < seen.size(); ++i)
+        {
+          if( ! seen[i] ) { CHECK(! layout.contains(layout.cell(static_cast<int64_t>(i)))); }
+        } // for: i
+      } // for: log
+    } // for: curve
+  } // SUBCASE: Layouts number every cell once
+
+  SUBCASE("Neighbors stay close")
+  {
+    // Average slot distance between vertical neighbors, row-major pays a
+    // whole row per step
+    auto spread = [](tiled::Layout const& layout)
+    {
+      int64_t total{0}, count{0};
+      for (int64_t r{0}; r < layout.rows()-1; ++r)
+      {
+        for (int64_t c{0}; c < layout.cols(); ++c)
+        {
+          total += std::abs(layout.index(Cell{r,c}) - layout.index(Cell{r+1,c}));
+          ++count;
+        } // for: c
+      } // for: r
+      return total / count;
+    };
+    tiled::Layout hilbert{{0,0},{255,255}, tiled::Curve::hilbert, 3};
+    tiled::Layout morton{{0,0},{255,255}, tiled::Curve::morton, 3};
+    CHECK(spread(hilbert) < 256);
+    CHECK(spread(morton) < 256);
+  } // SUBCASE: Neighbors stay close
+
+  SUBCASE("Dense store")
+  {
+    tiled::Store<int64_t> store{tiled::Layout{{-3,-3},{12,20}}, -1};
+    for (int64_t r{-3}; r <= 12; ++r)
+    {
+      for (int64_t c{-3}; c <= 20; ++c) { store[Cell{r,c}] = r*100+c; }
+    } // for: r
+    for (int64_t r{-3}; r <= 12; ++r)
+    {
+      for (int64_t c{-3}; c <= 20; ++c) { CHECK((store[Cell{r,c}] == r*100+c)); }
+    } // for: r
+    store.fill(0);
+    CHECK((store[Cell{5,5}] == 0));
+  } // SUBCASE: Dense store
+
+  SUBCASE("Sparse store")
+  {
+    tiled::Sparse<int64_t> store{tiled::Curve::hilbert, 3, -1};
+    CHECK(store.find(Cell{0,0}) == nullptr);
+
+    // Cells on both sides of the axes and far from the origin
+    std::vector<Cell> cells;
+    for (int64_t r{-20}; r < 20; ++r)
+    {
+      for (int64_t c{-20}; c < 20; ++c) { cells.emplace_back(r*1000003, c*7); }
+    } // for: r
+    for (auto&& p : cells) { store[p] = p.first ^ p.second; }
+    for (auto&& p : cells)
+    {
+      REQUIRE(store.find(p) != nullptr);
+      CHECK(*store.find(p) == (p.first ^ p.second));
+    } // for: p
+
+    std::set<std::pair<int64_t,int64_t>> tiles;
+    for (auto&& p : cells) { tiles.emplace(p.first >> 3, p.second >> 3); }
+    CHECK(store.tiles() == tiles.size());
+
+    // Untouched cells of an allocated tile keep the default value
+    CHECK(*store.find(Cell{1,1}) == -1);
+
+    store.clear();
+    CHECK(store.tiles() == 0);
+    CHECK(store.find(cells.front()) == nullptr);
+  } // SUBCASE: Sparse store
+
+  SUBCASE("Sparse store far apart cells")
+  {
+    // Tiles 2^31 or more apart, up to both ends of int64_t
+    tiled::Sparse<int64_t> store{tiled::Curve::hilbert, 3, -1};
+    constexpr int64_t lo {std::numeric_limits<int64_t>::min()};
+    constexpr int64_t hi {std::numeric_limits<int64_t>::max()};
+    std::vector<Cell> cells {{0,0},{int64_t{1}<<34,0},{0,int64_t{1}<<34},{int64_t{1}<<34,int64_t{1}<<34},
+      {-(int64_t{1}<<34),0},{lo,lo},{hi,hi},{lo,hi},{hi,lo},{lo,0},{0,hi}};
+    for (size_t i{0}; i < cells.size(); ++i) { store[cells[i]] = static_cast<int64_t>(i); }
+    CHECK(store.tiles() == cells.size());
+    for (size_t i{0}; i < cells.size(); ++i)
+    {
+      REQUIRE(store.find(cells[i]) != nullptr);
+      CHECK(*store.find(cells[i]) == static_cast<int64_t>(i));
+    } // for: i
+    CHECK(store.find(Cell{int64_t{1}<<35,0}) == nullptr);
+  } // SUBCASE: Sparse store far apart cells
+} // TEST_CASE: celaeno::math::tiled
+
+} // namespace celaeno::math::tiled::test